@@ -11,22 +11,54 @@
  ******************************************************************************/
 
 #include "Det.h"
+#include "tm4c123gh6pm_registers.h"
 
-/* Variables to store last DET error */
-uint16 Det_ModuleId = 0;       /*DET module ID*/
-uint8 Det_InstanceId = 0;      /*DET instance ID*/
-uint8 Det_ApiId = 0;           /* DET API ID*/
-uint8 Det_ErrorId = 0;         /* DET Error ID*/
+/* Ring buffer of the error records, the indexes are free running and wrap with the uint32 type.
+ * The module test runs without interrupts, so the stub has no critical section. */
+static Det_ErrorRecordType g_Error_Buffer[DET_BUFFER_SIZE];
+static uint32 g_Write_Index = 0;
+static uint32 g_Read_Index = 0;
+
+/* Number of the records overwritten before they were read */
+static uint32 g_Lost_Count = 0;
 
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId )
 {
-    Det_ModuleId = ModuleId; 
-    Det_InstanceId = InstanceId;
-    Det_ApiId = ApiId; 
-    Det_ErrorId = ErrorId;
+    Det_ErrorRecordType * record;
+
+    if((g_Write_Index - g_Read_Index) >= DET_BUFFER_SIZE)
+    {
+        /* Full: the oldest record is dropped so the latest errors are always kept */
+        g_Read_Index++;
+        g_Lost_Count++;
+    }
+    record = &g_Error_Buffer[g_Write_Index % DET_BUFFER_SIZE];
+    record->Timestamp  = DWT_CYCCNT_REG;
+    record->ModuleId   = ModuleId;
+    record->InstanceId = InstanceId;
+    record->ApiId      = ApiId;
+    record->ErrorId    = ErrorId;
+    g_Write_Index++;
     return E_OK;
 }
 
+Std_ReturnType Det_ReadError(Det_ErrorRecordType * Record)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((Record != NULL_PTR) && (g_Read_Index != g_Write_Index))
+    {
+        *Record = g_Error_Buffer[g_Read_Index % DET_BUFFER_SIZE];
+        g_Read_Index++;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+uint32 Det_GetLostCount(void)
+{
+    return g_Lost_Count;
+}
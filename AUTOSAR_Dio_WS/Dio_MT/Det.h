@@ -47,20 +47,41 @@
   #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Number of the error records kept in the ring buffer (power of 2), the oldest unread record
+ * is overwritten when it is full */
+#define DET_BUFFER_SIZE               (8U)
+
 /*******************************************************************************
- *                      External Variables                                     *
- *******************************************************************************/   
-extern uint16 Det_ModuleId;       /*DET module ID*/
-extern uint8 Det_InstanceId;      /*DET instance ID*/
-extern uint8 Det_ApiId;           /* DET API ID*/
-extern uint8 Det_ErrorId;         /* DET Error ID*/
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure of an error record:
+ *  1. core cycle counter (DWT CYCCNT) when the error was reported
+ *  2. the arguments of Det_ReportError
+ */
+typedef struct
+{
+    uint32 Timestamp;
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+}Det_ErrorRecordType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+
+/* Description: Append the error to the ring buffer and return */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
 		                        uint8 ErrorId );
 
+/* Description: Read and remove the oldest error record of the ring buffer, E_NOT_OK if it is empty */
+Std_ReturnType Det_ReadError(Det_ErrorRecordType * Record);
+
+/* Description: Return the number of error records overwritten before they were read */
+uint32 Det_GetLostCount(void);
+
 #endif /* DET_H */
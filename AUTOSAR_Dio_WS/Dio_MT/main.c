@@ -15,14 +15,17 @@
 
 #define DIO_INVALIDE_CHANNEL_NUM 50
 
+/* Read all the records of the Det ring buffer, TRUE if the last one is the expected error */
 boolean Det_TestLastReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId) 
 {
-    boolean result = (Det_ModuleId == ModuleId) && (Det_InstanceId == InstanceId) && 
-                     (Det_ApiId == ApiId) && (Det_ErrorId == ErrorId);
-    Det_ModuleId = 0;
-    Det_InstanceId = 0;
-    Det_ApiId = 0;
-    Det_ErrorId = 0;
+    Det_ErrorRecordType record;
+    boolean result = FALSE;
+
+    while(Det_ReadError(&record) == E_OK)
+    {
+        result = (record.ModuleId == ModuleId) && (record.InstanceId == InstanceId) && 
+                 (record.ApiId == ApiId) && (record.ErrorId == ErrorId);
+    }
     
     return result;
 }
@@ -194,6 +197,10 @@ void GPIO_Pins_Init(void)
 
 int main(void)
 {
+    /* Start the DWT cycle counter used for the Det timestamps (DEMCR TRCENA, DWT CYCCNTENA) */
+    CORE_DEMCR_REG |= 0x01000000;
+    DWT_CTRL_REG |= 0x00000001;
+
     /* Initialize PF0, PF1, PF2 and PF4 as GPIO pins */
     GPIO_Pins_Init();
     
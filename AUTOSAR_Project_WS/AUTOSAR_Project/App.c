@@ -10,53 +10,260 @@
  ******************************************************************************/
 
 #include "App.h"
+#include "Os.h"
 #include "Button.h"
 #include "Led.h"
 #include "Dio.h"
+#include "Fault.h"
+#include "Gpt.h"
+#include "Icu.h"
+#include "Irq.h"
 #include "Mcu.h"
 #include "Port.h"
+#include "Rte.h"
+#include "Pwm.h"
+#include "SwPwm.h"
+#include "Uart.h"
 
 extern const Port_ConfigType Port_PinConfig;
+
+/* Description: Structure to map a gesture to its action:
+ *  1. the gesture (BUTTON_GESTURE_xxx)
+ *  2. the button Id (the chord index for BUTTON_GESTURE_CHORD)
+ *  3. the function executed by the App Task
+ */
+typedef struct
+{
+    Button_GestureType Gesture;
+    uint8 Id;
+    void (*Action)(void);
+}App_GestureActionType;
+
+/* Brightness removed from the led on each dimming step */
+#define APP_BRIGHTNESS_STEP  (LED_BRIGHTNESS_MAX / 4U)
+
+/* State of the led and its brightness requested from the Led Task through the Rte */
+static boolean g_App_LedOn = FALSE;
+static uint8 g_App_Brightness = LED_BRIGHTNESS_DEFAULT;
+
+/* Description: Toggle the led */
+static void App_ToggleLed(void)
+{
+    g_App_LedOn = (boolean)(g_App_LedOn == FALSE);
+    (void)Rte_Write_App_LedState(g_App_LedOn);
+}
+
+/* Description: Dim the led by one step, from the lowest step it goes back to full brightness */
+static void App_DimLed(void)
+{
+    if(g_App_Brightness > APP_BRIGHTNESS_STEP)
+    {
+        g_App_Brightness -= APP_BRIGHTNESS_STEP;
+    }
+    else
+    {
+        g_App_Brightness = LED_BRIGHTNESS_MAX;
+    }
+    g_App_LedOn = TRUE;
+    (void)Rte_Write_App_LedBrightness(g_App_Brightness);
+    (void)Rte_Write_App_LedState(g_App_LedOn);
+}
+
+/* Actions of the gestures, a gesture which is not listed is ignored */
+static const App_GestureActionType App_GestureActions[] = {
+    {BUTTON_GESTURE_CLICK,      ButtonConf_SW1, App_ToggleLed},
+    {BUTTON_GESTURE_LONG_PRESS, ButtonConf_SW1, App_DimLed},
+    {BUTTON_GESTURE_REPEAT,     ButtonConf_SW1, App_DimLed}
+};
+
+#define APP_NUMBER_OF_GESTURE_ACTIONS  (sizeof(App_GestureActions) / sizeof(App_GestureActions[0]))
+
+/* Heartbeat: two short dim flashes every second until the LED is stopped */
+static const Led_PatternStepType App_HeartbeatSteps[] = {
+    {LED_BRIGHTNESS_MAX / 8U, 80}, {0, 160}, {LED_BRIGHTNESS_MAX / 8U, 80}, {0, 680}
+};
+static const Led_PatternType App_HeartbeatPattern = {App_HeartbeatSteps, 4, LED_PATTERN_FOREVER};
+
+/* Blink count: one blink per play, the number of plays is the diagnostic code */
+static const Led_PatternStepType App_BlinkCountSteps[] = {
+    {LED_BRIGHTNESS_MAX, 200}, {0, 400}
+};
+
+/* Reset cause code indexed by Mcu_ResetType: 1 blink for a power-on reset up to 7 for an undefined cause */
+static const Led_PatternType App_ResetCodePatterns[] = {
+    {App_BlinkCountSteps, 2, 1}, {App_BlinkCountSteps, 2, 2}, {App_BlinkCountSteps, 2, 3},
+    {App_BlinkCountSteps, 2, 4}, {App_BlinkCountSteps, 2, 5}, {App_BlinkCountSteps, 2, 6},
+    {App_BlinkCountSteps, 2, 7}
+};
+
+/* Fast error flash: 12.5 Hz for 4 seconds */
+static const Led_PatternStepType App_ErrorFlashSteps[] = {
+    {LED_BRIGHTNESS_MAX, 40}, {0, 40}
+};
+static const Led_PatternType App_ErrorFlashPattern = {App_ErrorFlashSteps, 2, 50};
+
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
-    /* Initialize Mcu Driver */
-    Mcu_Init();
-    
+    Mcu_ResetType reset;
+
+    /* Move the vector table to RAM before the drivers install their handlers */
+    Irq_Init();
+
+    /* Report the MemManage, BusFault and UsageFault exceptions with their own cause in the crash record */
+    Fault_Init();
+
+    /* Initialize Mcu Driver, it latches the reset cause */
+    Mcu_Init(&Mcu_Configuration);
+
+    /* Warm boot: after a software or watchdog reset the outputs get back their levels from before the
+     * reset. They are written in GPIODATA while the pins are still inputs, so PORT_Init drives them
+     * with these levels directly. It is done on the reset clock so it does not wait for the PLL lock */
+    reset = Mcu_GetResetReason();
+    if((MCU_SW_RESET == reset) || (MCU_WATCHDOG_RESET == reset))
+    {
+        Port_PreloadOutputLevels(&Port_PinConfig);
+        (void)Dio_RestoreOutputs();
+    }
+
     PORT_Init(&Port_PinConfig);
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
-    /* Initialize LED Driver */
-    
+    /* Run the core at 80 MHz from the PLL */
+    if(E_OK == Mcu_InitClock(McuConf_CLOCK_HIGH_PERFORMANCE))
+    {
+        while(MCU_PLL_LOCKED != Mcu_GetPllStatus());
+        (void)Mcu_DistributePllClock();
+    }
+
+    /* Initialize Gpt Driver, its channels are started by the modules using them */
+    Gpt_Init(&Gpt_Configuration);
+
+    /* Initialize the Pwm Driver, its generators drive the LED pins without cpu load.
+     * Warm boot: the LEDs get back the duty cycles they had before the reset */
+    Pwm_Init(&Pwm_Configuration);
+    if((MCU_SW_RESET == reset) || (MCU_WATCHDOG_RESET == reset))
+    {
+        (void)Pwm_RestoreOutputs();
+    }
+
+    /* Initialize the Uart Driver, the console bytes are sent and received by its interrupts */
+    Uart_Init(&Uart_Configuration);
+
+#if (LED_BACKEND == LED_BACKEND_SWPWM)
+    /* Initialize the Software PWM Driver, it dims the LEDs from the edges of its Gpt channel */
+    SwPwm_Init(&SwPwm_Configuration);
+#endif
+
+    /* Initialize Icu Driver */
+    Icu_Init(&Icu_Configuration);
+
+    /* Initialize the Button Module, the button pins are read by port and their edges start the debouncing */
+    Button_Init(&Button_Configuration);
+
+    /* Start the diagnostic patterns of the LEDs: heartbeat on the green LED, the reset cause as a blink count
+     * on the blue LED and a fast flash on the red LED after a crash. The crash is reported once, the record
+     * is cleared so the next reset does not flash it again */
+    (void)Led_PlayPattern(LedConf_GREEN_CHANNEL_ID_INDEX, &App_HeartbeatPattern);
+    (void)Led_PlayPattern(LedConf_BLUE_CHANNEL_ID_INDEX, &App_ResetCodePatterns[reset]);
+    if(TRUE == Fault_IsRecordValid())
+    {
+        (void)Led_PlayPattern(LedConf_RED_CHANNEL_ID_INDEX, &App_ErrorFlashPattern);
+        Fault_ClearRecord();
+    }
+}
+
+/* Description: Called from the GPIO Port F interrupt on each SW1 edge */
+void App_Sw1EdgeNotification(void)
+{
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+    Button_EdgeNotification(ButtonConf_SW1);
+#else
+    /* Only wake the periodic sampling, the edges of a bouncing contact are not sampled themselves.
+     * E_OS_STATE is returned while the sampling is already running */
+    (void)SetRelAlarm(OS_ALARM_BUTTON, 1, 0);
+#endif
+}
+
+/* Description: Called by the Button Module when a button state changes, it runs the Button Task */
+void App_ButtonChangeNotification(void)
+{
+    (void)ActivateTask(OS_TASK_BUTTON);
+}
+
+/* Description: Called by the Button Module when it queues gesture events, it runs the App Task */
+void App_GestureNotification(void)
+{
+    (void)ActivateTask(OS_TASK_APP);
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task activated by the button changes, then every 20 Mili-seconds while a gesture is in progress.
+ *              In polling mode it is activated by OS_ALARM_BUTTON one tick after the first SW1 edge,
+ *              then every 20 Mili-seconds until the button state is confirmed */
 void Button_Task(void)
 {
+    boolean active;
+
+#if (BUTTON_INTERRUPT_MODE == STD_OFF)
     Button_RefreshState();
+    active = Button_IsDebouncing();
+#else
+    active = FALSE;
+#endif
+
+    Button_GestureTick();
+
+    /* Run again in the next Os tick while a gesture times out, the alarm may already be running */
+    if((active == TRUE) || (Button_GestureIsActive() == TRUE))
+    {
+        (void)SetRelAlarm(OS_ALARM_BUTTON, 1, 0);
+    }
 }
 
-/* Description: Task executes every 40 Mili-seconds to refresh the LED */
+/* Description: Task executes every 40 Mili-seconds to play the LED patterns and apply the led requests of the App,
+ *              the led is only updated when a request changed */
 void Led_Task(void)
 {
-    Led_RefreshOutput();
+    boolean state;
+    uint8 brightness;
+
+    Led_PatternTick();
+
+    if(Rte_IsUpdated_Led_Brightness() == TRUE)
+    {
+        (void)Rte_Read_Led_Brightness(&brightness);
+        Led_SetBrightness(brightness);
+    }
+
+    if(Rte_IsUpdated_Led_State() == TRUE)
+    {
+        (void)Rte_Read_Led_State(&state);
+        if(state == TRUE)
+        {
+            Led_SetOn();
+        }
+        else
+        {
+            Led_SetOff();
+        }
+    }
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the gesture events to run the action of each gesture */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
+    Button_GestureEventType event;
+    uint8 index;
 
-    button_current_state = Button_GetState(); /* Read the button state */
-
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    while(E_OK == Button_ReadGesture(&event))
     {
-        Led_Toggle();
+        for(index = 0; index < APP_NUMBER_OF_GESTURE_ACTIONS; index++)
+        {
+            if((App_GestureActions[index].Gesture == event.Gesture) && (App_GestureActions[index].Id == event.Id))
+            {
+                (*App_GestureActions[index].Action)();
+            }
+        }
     }
-
-    button_previous_state = button_current_state;
 }
@@ -17,13 +17,22 @@
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Called from the GPIO Port F interrupt on each SW1 edge */
+void App_Sw1EdgeNotification(void);
+
+/* Description: Called by the Button Module when a button state changes, it runs the Button Task */
+void App_ButtonChangeNotification(void);
+
+/* Description: Called by the Button Module when it queues gesture events, it runs the App Task */
+void App_GestureNotification(void);
+
+/* Description: Task activated by the button changes, then every 20 Mili-seconds while a gesture is in progress */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by the gesture events to run the action of each gesture */
 void App_Task(void);
 
 #endif /* APP_H_ */
@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: Board
+ *
+ * File Name: Board_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file of the board wiring shared by the MCAL
+ *              configurations and the ECU abstraction modules (Port_PBcfg.c and Led)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef BOARD_CFG_H
+#define BOARD_CFG_H
+
+/* Drivers which can dim the LEDs on PF1 .. PF3 */
+#define LED_BACKEND_PWM     (0U)    /* M1PWM5 .. M1PWM7 generators, the pins are in PWM_MODE */
+#define LED_BACKEND_SWPWM   (1U)    /* Edges of a Gpt channel, the pins are in GPIO_MODE */
+
+/* Driver which dims the LEDs, Port_PBcfg.c selects the mode of the LED pins from it */
+#define LED_BACKEND         LED_BACKEND_PWM
+
+#endif /* BOARD_CFG_H */
@@ -9,74 +9,625 @@
  * Author: Mohamed Tarek
  ******************************************************************************/
 #include "Dio.h"
-#include "Port.h"
+#include "Os.h"
 #include "Button.h"
 
-/* Button Configurations Structure */
-//static Port_ConfigType g_Button_Config;
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+#include "Gpt.h"
+#include "Mcu.h"
+#endif
 
-/* Global variable to hold the button state */
-static uint8 g_button_state = BUTTON_RELEASED;
+/* The samples of 4 ports are packed in a word (port p --> bits 8*(p%4) to 8*(p%4)+7 of word p/4) */
+#define BUTTON_PORTS_PER_WORD      (4U)
+#define BUTTON_NUMBER_OF_WORDS     ((DIO_NUMBER_OF_PORTS + BUTTON_PORTS_PER_WORD - 1U) / BUTTON_PORTS_PER_WORD)
+
+/* Word and bit of a pin in the packed samples */
+#define BUTTON_WORD(PORT)          ((PORT) / BUTTON_PORTS_PER_WORD)
+#define BUTTON_BIT(PORT, PIN)      ((((PORT) % BUTTON_PORTS_PER_WORD) * 8U) + (PIN))
+
+#if ((BUTTON_NUMBER_OF_BUTTONS == 0U) || (BUTTON_NUMBER_OF_BUTTONS > 32U))
+  #error "BUTTON_NUMBER_OF_BUTTONS must be between 1 and 32"
+#endif
+
+#if (BUTTON_DEBOUNCE_SAMPLES != 3U)
+  #error "The 2-bit vertical counters of Button_RefreshState confirm a new state on the third sample"
+#endif
+
+#if ((BUTTON_GESTURE_QUEUE_SIZE & (BUTTON_GESTURE_QUEUE_SIZE - 1U)) != 0U)
+  #error "BUTTON_GESTURE_QUEUE_SIZE must be a power of 2 (the queue indexes are free running)"
+#endif
+
+/* Gesture states of a button */
+#define BUTTON_STATE_IDLE          (0U)   /* released, no gesture in progress                        */
+#define BUTTON_STATE_PRESSED       (1U)   /* pressed for less than the long press time               */
+#define BUTTON_STATE_HELD          (2U)   /* pressed after the long press, it repeats                 */
+#define BUTTON_STATE_RELEASED      (3U)   /* released after a short press, waiting for a second press */
+#define BUTTON_STATE_SECOND        (4U)   /* second press of a double-click until it is released      */
+#define BUTTON_STATE_CHORD         (5U)   /* member of a reported chord until it is released          */
+#define BUTTON_NUMBER_OF_STATES    (6U)
+
+/* Inputs of the gesture state machine */
+#define BUTTON_INPUT_PRESS         (0U)
+#define BUTTON_INPUT_RELEASE       (1U)
+#define BUTTON_INPUT_TIMEOUT       (2U)
+#define BUTTON_NUMBER_OF_INPUTS    (3U)
+
+/* Gesture timer set by a transition (index in Button_TimerTicks), KEEP leaves the running timer unchanged */
+#define BUTTON_TIMER_NONE          (0U)
+#define BUTTON_TIMER_LONG_PRESS    (1U)
+#define BUTTON_TIMER_DOUBLE_CLICK  (2U)
+#define BUTTON_TIMER_REPEAT        (3U)
+#define BUTTON_TIMER_KEEP          (4U)
+
+/* Threshold in ms rounded up to the ticks of BUTTON_GESTURE_COUNTER */
+#define BUTTON_MS_TO_TICKS(MS)     (((MS) + BUTTON_GESTURE_TICK_MS - 1U) / BUTTON_GESTURE_TICK_MS)
+
+/* Description: Structure of a transition of the gesture state machine:
+ *  1. the next state
+ *  2. the gesture reported (BUTTON_GESTURE_NONE if none)
+ *  3. the timer set (BUTTON_TIMER_xxx)
+ */
+typedef struct
+{
+    uint8 NextState;
+    Button_GestureType Gesture;
+    uint8 Timer;
+}Button_TransitionType;
+
+/* Duration of each gesture timer in counter ticks */
+static const uint16 Button_TimerTicks[BUTTON_TIMER_KEEP] = {
+    0U,
+    BUTTON_MS_TO_TICKS(BUTTON_LONG_PRESS_MS),
+    BUTTON_MS_TO_TICKS(BUTTON_DOUBLE_CLICK_MS),
+    BUTTON_MS_TO_TICKS(BUTTON_REPEAT_PERIOD_MS)
+};
+
+/* Gesture state machine --> Next state, Gesture, Timer for each state and input (the inputs which can not
+ * happen in a state keep it) */
+static const Button_TransitionType Button_GestureTable[BUTTON_NUMBER_OF_STATES][BUTTON_NUMBER_OF_INPUTS] = {
+    /*                   PRESS                                                            RELEASE                                                          TIMEOUT */
+    /* IDLE     */ { {BUTTON_STATE_PRESSED, BUTTON_GESTURE_NONE,         BUTTON_TIMER_LONG_PRESS}, {BUTTON_STATE_IDLE,     BUTTON_GESTURE_NONE, BUTTON_TIMER_KEEP},         {BUTTON_STATE_IDLE,   BUTTON_GESTURE_NONE,       BUTTON_TIMER_NONE}   },
+    /* PRESSED  */ { {BUTTON_STATE_PRESSED, BUTTON_GESTURE_NONE,         BUTTON_TIMER_KEEP},       {BUTTON_STATE_RELEASED, BUTTON_GESTURE_NONE, BUTTON_TIMER_DOUBLE_CLICK}, {BUTTON_STATE_HELD,   BUTTON_GESTURE_LONG_PRESS, BUTTON_TIMER_REPEAT} },
+    /* HELD     */ { {BUTTON_STATE_HELD,    BUTTON_GESTURE_NONE,         BUTTON_TIMER_KEEP},       {BUTTON_STATE_IDLE,     BUTTON_GESTURE_NONE, BUTTON_TIMER_NONE},         {BUTTON_STATE_HELD,   BUTTON_GESTURE_REPEAT,     BUTTON_TIMER_REPEAT} },
+    /* RELEASED */ { {BUTTON_STATE_SECOND,  BUTTON_GESTURE_DOUBLE_CLICK, BUTTON_TIMER_NONE},       {BUTTON_STATE_RELEASED, BUTTON_GESTURE_NONE, BUTTON_TIMER_KEEP},         {BUTTON_STATE_IDLE,   BUTTON_GESTURE_CLICK,      BUTTON_TIMER_NONE}   },
+    /* SECOND   */ { {BUTTON_STATE_SECOND,  BUTTON_GESTURE_NONE,         BUTTON_TIMER_KEEP},       {BUTTON_STATE_IDLE,     BUTTON_GESTURE_NONE, BUTTON_TIMER_NONE},         {BUTTON_STATE_SECOND, BUTTON_GESTURE_NONE,       BUTTON_TIMER_NONE}   },
+    /* CHORD    */ { {BUTTON_STATE_CHORD,   BUTTON_GESTURE_NONE,         BUTTON_TIMER_KEEP},       {BUTTON_STATE_IDLE,     BUTTON_GESTURE_NONE, BUTTON_TIMER_NONE},         {BUTTON_STATE_CHORD,  BUTTON_GESTURE_NONE,       BUTTON_TIMER_NONE}   }
+};
+
+/* Bit index of the lowest set bit of a mask from its isolated bit (de Bruijn sequence 0x077CB531) */
+static const uint8 Button_DeBruijnIndex[32] = {
+    0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+    31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+};
+#define BUTTON_LOWEST_ID(MASK)     (Button_DeBruijnIndex[(((MASK) & (0U - (MASK))) * 0x077CB531UL) >> 27])
+
+/* Global pointer to the configured buttons and to the state change notification */
+static const Button_PinConfigType * g_Buttons = NULL_PTR;
+static void (*g_Change_Notification)(void) = NULL_PTR;
+
+/* Ports read by each refresh, bit p --> Dio Port p */
+static uint8 g_Sampled_Ports = 0;
+
+/* Packed masks of the button pins and of the pins pressed at low level */
+static uint32 g_Pin_Mask[BUTTON_NUMBER_OF_WORDS];
+static uint32 g_Active_Low[BUTTON_NUMBER_OF_WORDS];
+
+/* Debounced state of the packed pins (bit set --> pressed) and the two bits of their vertical counters,
+ * a counter counts the consecutive samples which differ from the state */
+static uint32 g_Debounced[BUTTON_NUMBER_OF_WORDS];
+static uint32 g_Count_Bit0[BUTTON_NUMBER_OF_WORDS];
+static uint32 g_Count_Bit1[BUTTON_NUMBER_OF_WORDS];
+
+/* State of the buttons and the edges not read yet (bit n --> button n) */
+static uint32 g_Button_States = 0;
+static uint32 g_Pressed_Edges = 0;
+static uint32 g_Released_Edges = 0;
+
+/* Gesture state machines: state and remaining timer ticks of each button, the buttons with a running timer,
+ * the buttons pressed as seen by the state machines and the edges not processed yet (bit n --> button n) */
+static uint8 g_Gesture_State[BUTTON_NUMBER_OF_BUTTONS];
+static uint16 g_Gesture_Timer[BUTTON_NUMBER_OF_BUTTONS];
+static uint32 g_Gesture_Timing = 0;
+static uint32 g_Gesture_Down = 0;
+static uint32 g_Gesture_Pressed = 0;
+static uint32 g_Gesture_Released = 0;
+static TickType g_Gesture_Last_Tick = 0;
+static const uint32 * g_Chords = NULL_PTR;
+static void (*g_Gesture_Notification)(void) = NULL_PTR;
+
+/* Gesture events for the App, written by Button_GestureTick and read by Button_ReadGesture only
+ * (single producer and single consumer, each index is written by one side) */
+static Button_GestureEventType g_Gesture_Queue[BUTTON_GESTURE_QUEUE_SIZE];
+static volatile uint8 g_Gesture_Write = 0;
+static volatile uint8 g_Gesture_Read = 0;
+
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+/* Buttons confirmed when the running debounce timer expires, and the buttons with an edge after its start
+ * which need a full debounce time of their own (bit n --> button n) */
+static uint32 g_Debounce_Pending = 0;
+static uint32 g_Debounce_Next = 0;
+#endif
+
+/*******************************************************************************************************************/
+/* Rebuild the button states from the debounced pins, record the edges then notify the change */
+static void Button_PublishStates(void)
+{
+    uint32 states = 0;
+    uint8 id;
+    Dio_PortType port;
+
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        port = g_Buttons[id].Port;
+        if(g_Debounced[BUTTON_WORD(port)] & ((uint32)1U << BUTTON_BIT(port, g_Buttons[id].Pin)))
+        {
+            states |= BUTTON_MASK(id);
+        }
+    }
+
+    SuspendAllInterrupts();
+    g_Pressed_Edges    |= states & ~g_Button_States;
+    g_Released_Edges   |= g_Button_States & ~states;
+    g_Gesture_Pressed  |= states & ~g_Button_States;
+    g_Gesture_Released |= g_Button_States & ~states;
+    g_Button_States     = states;
+    ResumeAllInterrupts();
+
+    if(g_Change_Notification != NULL_PTR)
+    {
+        (*g_Change_Notification)();
+    }
+}
+
+/*******************************************************************************************************************/
+/* Read each sampled port once, the pins of the pressed buttons are returned as set bits */
+static void Button_SamplePorts(uint32 * Pressed)
+{
+    uint32 sample[BUTTON_NUMBER_OF_WORDS];
+    uint8 word;
+    Dio_PortType port;
+
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        sample[word] = 0;
+    }
+    for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+    {
+        if(g_Sampled_Ports & (1U << port))
+        {
+            sample[BUTTON_WORD(port)] |= (uint32)Dio_ReadPort(port) << BUTTON_BIT(port, 0);
+        }
+    }
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        Pressed[word] = (sample[word] ^ g_Active_Low[word]) & g_Pin_Mask[word];
+    }
+}
+
+/*******************************************************************************************************************/
+void Button_Init(const Button_ConfigType * ConfigPtr)
+{
+    uint8 word;
+    uint8 id;
+    Dio_PortType port;
+
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        g_Pin_Mask[word]   = 0;
+        g_Active_Low[word] = 0;
+        g_Debounced[word]  = 0;
+        g_Count_Bit0[word] = 0;
+        g_Count_Bit1[word] = 0;
+    }
+    g_Sampled_Ports  = 0;
+    g_Button_States  = 0;
+    g_Pressed_Edges  = 0;
+    g_Released_Edges = 0;
+
+    g_Buttons = ConfigPtr->Buttons;
+    g_Change_Notification = ConfigPtr->ChangeNotification;
+    g_Chords = ConfigPtr->Chords;
+    g_Gesture_Notification = ConfigPtr->GestureNotification;
+
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        g_Gesture_State[id] = BUTTON_STATE_IDLE;
+        g_Gesture_Timer[id] = 0;
+    }
+    g_Gesture_Timing   = 0;
+    g_Gesture_Down     = 0;
+    g_Gesture_Pressed  = 0;
+    g_Gesture_Released = 0;
+    g_Gesture_Write    = 0;
+    g_Gesture_Read     = 0;
+    (void)GetCounterValue(BUTTON_GESTURE_COUNTER, &g_Gesture_Last_Tick);
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        port = g_Buttons[id].Port;
+        g_Sampled_Ports |= (uint8)(1U << port);
+        g_Pin_Mask[BUTTON_WORD(port)] |= (uint32)1U << BUTTON_BIT(port, g_Buttons[id].Pin);
+        if(g_Buttons[id].PressedLevel == STD_LOW)
+        {
+            g_Active_Low[BUTTON_WORD(port)] |= (uint32)1U << BUTTON_BIT(port, g_Buttons[id].Pin);
+        }
+    }
+
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+    g_Debounce_Pending = 0;
+    g_Debounce_Next    = 0;
+    Gpt_EnableNotification(BUTTON_DEBOUNCE_GPT_CHANNEL);
+#endif
+
+    /* The button edges start the debouncing */
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        Icu_EnableNotification(g_Buttons[id].IcuChannel);
+    }
+}
 
 /*******************************************************************************************************************/
-/* Description: Called by the Button_Init function (only) used to fill the Button configurations structure */
-//static void Button_FillConfigurations(void)
-//{
-//    g_Button_Config.Pins->port_num  = BUTTON_PORT;             /* Set Button PORT value */
-//    g_Button_Config.Pins->pin_num   = BUTTON_PIN_NUM;          /* Set Button PIN Number value */
-//    g_Button_Config.Pins->direction = INPUT;                   /* Set Button as INPUT pin */
-//    g_Button_Config.Pins->resistor  = PULL_UP;                 /* Enable Intrnal pull up at this pin */
-//    g_Button_Config.Pins->initial_value  = BUTTON_RELEASED;    /* Button is released */
-//    g_Button_Config.Pins->pin_mode = GPIO_MODE;
-//}
-//
-///*******************************************************************************************************************/
-//void Button_Init(void)
-//{
-//    Button_FillConfigurations();
-//    // PORT_Init(&g_Button_Config);
-//    // Port_SetupGpioPin(&g_Button_Config);
-//}
+uint8 Button_GetState(Button_IdType ButtonId)
+{
+    return ((g_Button_States & BUTTON_MASK(ButtonId)) != 0) ? BUTTON_PRESSED : BUTTON_RELEASED;
+}
 
 /*******************************************************************************************************************/
-uint8 Button_GetState(void)
+uint32 Button_GetStates(void)
 {
-    return g_button_state;
+    return g_Button_States;
+}
+
+/*******************************************************************************************************************/
+void Button_ReadEdges(uint32 * Pressed, uint32 * Released)
+{
+    SuspendAllInterrupts();
+    *Pressed  = g_Pressed_Edges;
+    *Released = g_Released_Edges;
+    g_Pressed_Edges  = 0;
+    g_Released_Edges = 0;
+    ResumeAllInterrupts();
+}
+
+/*******************************************************************************************************************/
+boolean Button_IsDebouncing(void)
+{
+    uint32 counting = 0;
+    uint8 word;
+
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        counting |= g_Count_Bit0[word] | g_Count_Bit1[word];
+    }
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+    counting |= g_Debounce_Pending | g_Debounce_Next;
+#endif
+    return (boolean)(counting != 0);
 }
 
 /*******************************************************************************************************************/
 void Button_RefreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint32 pressed[BUTTON_NUMBER_OF_WORDS];
+    uint32 delta;
+    uint32 toggle;
+    uint32 changed = 0;
+    uint8 word;
+
+    /* One read per configured port */
+    Button_SamplePorts(pressed);
+
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        /* The pins which differ from their debounced state */
+        delta = pressed[word] ^ g_Debounced[word];
+
+        /* A pin whose counter is at 2 gets its third differing sample: its state changes */
+        toggle = delta & g_Count_Bit1[word] & ~g_Count_Bit0[word];
+
+        /* Count up the differing pins, clear the counter of the others and of the toggled ones */
+        g_Count_Bit1[word] = (g_Count_Bit1[word] ^ g_Count_Bit0[word]) & delta & ~toggle;
+        g_Count_Bit0[word] = ~g_Count_Bit0[word] & delta & ~toggle;
+
+        g_Debounced[word] ^= toggle;
+        changed |= toggle;
+    }
+
+    /* The button masks are only rebuilt when a state changed */
+    if(changed != 0)
+    {
+        Button_PublishStates();
+    }
+}
+
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+/*******************************************************************************************************************/
+/* Start the one-shot debounce timer, its ticks are computed from the current system clock */
+static void Button_StartDebounceTimer(void)
+{
+    Gpt_StartTimer(BUTTON_DEBOUNCE_GPT_CHANNEL, (Mcu_GetSysClockFrequency() / 1000U) * BUTTON_DEBOUNCE_TIME_MS);
+}
+
+/*******************************************************************************************************************/
+void Button_EdgeNotification(Button_IdType ButtonId)
+{
+    boolean start = FALSE;
+
+    /* No more interrupts from the bounces of this button until its level is confirmed */
+    Icu_DisableNotification(g_Buttons[ButtonId].IcuChannel);
+
+    /* The debounce timer interrupt has a higher priority than the Icu one */
+    SuspendAllInterrupts();
+    if(g_Debounce_Pending == 0)
+    {
+        g_Debounce_Pending = BUTTON_MASK(ButtonId);
+        start = TRUE;
+    }
+    else
+    {
+        g_Debounce_Next |= BUTTON_MASK(ButtonId);
+    }
+    ResumeAllInterrupts();
+
+    if(start == TRUE)
+    {
+        Button_StartDebounceTimer();
+    }
+}
+
+/*******************************************************************************************************************/
+void Button_DebounceNotification(void)
+{
+    uint32 pressed[BUTTON_NUMBER_OF_WORDS];
+    uint32 pins[BUTTON_NUMBER_OF_WORDS];
+    uint32 confirmed;
+    uint32 delta;
+    uint32 changed = 0;
+    uint8 word;
+    uint8 id;
+    Dio_PortType port;
+
+    SuspendAllInterrupts();
+    confirmed = g_Debounce_Pending;
+    g_Debounce_Pending = g_Debounce_Next;
+    g_Debounce_Next = 0;
+    ResumeAllInterrupts();
+
+    /* The buttons with an edge during this debounce time get the next one */
+    if(g_Debounce_Pending != 0)
+    {
+        Button_StartDebounceTimer();
+    }
+
+    /* Discard the bounces latched while the channels were masked, an edge after this point is notified
+     * as soon as the channel is unmasked */
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        pins[word] = 0;
+    }
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        if(confirmed & BUTTON_MASK(id))
+        {
+            (void)Icu_GetInputState(g_Buttons[id].IcuChannel);
+            port = g_Buttons[id].Port;
+            pins[BUTTON_WORD(port)] |= (uint32)1U << BUTTON_BIT(port, g_Buttons[id].Pin);
+        }
+    }
+
+    /* The level after the debounce time is the new state of the confirmed buttons */
+    Button_SamplePorts(pressed);
+    for(word = 0; word < BUTTON_NUMBER_OF_WORDS; word++)
+    {
+        delta = (pressed[word] ^ g_Debounced[word]) & pins[word];
+        g_Debounced[word] ^= delta;
+        changed |= delta;
+    }
+
+    for(id = 0; id < BUTTON_NUMBER_OF_BUTTONS; id++)
+    {
+        if(confirmed & BUTTON_MASK(id))
+        {
+            Icu_EnableNotification(g_Buttons[id].IcuChannel);
+        }
+    }
+
+    if(changed != 0)
+    {
+        Button_PublishStates();
+    }
+}
+#endif
+
+/*******************************************************************************************************************/
+/* Queue a gesture event, it is dropped when the queue is full */
+static void Button_QueueGesture(Button_GestureType Gesture, uint8 Id)
+{
+    uint8 write = g_Gesture_Write;
+
+    if((uint8)(write - g_Gesture_Read) < BUTTON_GESTURE_QUEUE_SIZE)
+    {
+        g_Gesture_Queue[write % BUTTON_GESTURE_QUEUE_SIZE].Gesture = Gesture;
+        g_Gesture_Queue[write % BUTTON_GESTURE_QUEUE_SIZE].Id = Id;
+        g_Gesture_Write = (uint8)(write + 1U);
+    }
+}
+
+#if (BUTTON_NUMBER_OF_CHORDS > 0U)
+/*******************************************************************************************************************/
+/* A press completing a chord whose buttons are all still in their first short press reports the chord,
+ * the buttons of the chord report nothing else until they are released */
+static void Button_CheckChords(Button_IdType ButtonId)
+{
+    uint32 members;
+    uint32 short_press;
+    uint8 chord;
+
+    for(chord = 0; chord < BUTTON_NUMBER_OF_CHORDS; chord++)
+    {
+        if(((g_Chords[chord] & BUTTON_MASK(ButtonId)) != 0) && ((g_Gesture_Down & g_Chords[chord]) == g_Chords[chord]))
+        {
+            short_press = 0;
+            for(members = g_Chords[chord]; members != 0; members &= members - 1U)
+            {
+                if(g_Gesture_State[BUTTON_LOWEST_ID(members)] == BUTTON_STATE_PRESSED)
+                {
+                    short_press |= members & (0U - members);
+                }
+            }
+
+            if(short_press == g_Chords[chord])
+            {
+                for(members = g_Chords[chord]; members != 0; members &= members - 1U)
+                {
+                    g_Gesture_State[BUTTON_LOWEST_ID(members)] = BUTTON_STATE_CHORD;
+                }
+                g_Gesture_Timing &= ~g_Chords[chord];
+                Button_QueueGesture(BUTTON_GESTURE_CHORD, chord);
+                break;
+            }
+        }
+    }
+}
+#endif
+
+/*******************************************************************************************************************/
+/* Apply an input to the gesture state machine of a button */
+static void Button_GestureInput(Button_IdType ButtonId, uint8 Input)
+{
+    const Button_TransitionType * transition = &Button_GestureTable[g_Gesture_State[ButtonId]][Input];
 
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
+    g_Gesture_State[ButtonId] = transition->NextState;
 
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
+    if(transition->Gesture != BUTTON_GESTURE_NONE)
+    {
+        Button_QueueGesture(transition->Gesture, ButtonId);
+    }
 
-    if(state == BUTTON_PRESSED)
+    if(transition->Timer == BUTTON_TIMER_NONE)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        g_Gesture_Timing &= ~BUTTON_MASK(ButtonId);
+    }
+    else if(transition->Timer != BUTTON_TIMER_KEEP)
+    {
+        g_Gesture_Timer[ButtonId] = Button_TimerTicks[transition->Timer];
+        g_Gesture_Timing |= BUTTON_MASK(ButtonId);
     }
     else
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        /* No Action Required */
     }
 
-    if(g_Pressed_Count == 3)
+    if(Input == BUTTON_INPUT_PRESS)
+    {
+        g_Gesture_Down |= BUTTON_MASK(ButtonId);
+#if (BUTTON_NUMBER_OF_CHORDS > 0U)
+        Button_CheckChords(ButtonId);
+#endif
+    }
+    else if(Input == BUTTON_INPUT_RELEASE)
+    {
+        g_Gesture_Down &= ~BUTTON_MASK(ButtonId);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*******************************************************************************************************************/
+void Button_GestureTick(void)
+{
+    uint32 pressed;
+    uint32 released;
+    uint32 states;
+    uint32 active;
+    TickType now;
+    TickType elapsed;
+    uint8 write = g_Gesture_Write;
+    Button_IdType id;
+
+    /* Counter ticks since the last call, the counter wraps after its maxallowedvalue */
+    (void)GetCounterValue(BUTTON_GESTURE_COUNTER, &now);
+    if(now >= g_Gesture_Last_Tick)
     {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
+        elapsed = now - g_Gesture_Last_Tick;
     }
-    else if(g_Released_Count == 3)
+    else
+    {
+        elapsed = (Os_CounterConfig[BUTTON_GESTURE_COUNTER].maxallowedvalue - g_Gesture_Last_Tick) + now + 1U;
+    }
+    g_Gesture_Last_Tick = now;
+
+    SuspendAllInterrupts();
+    pressed  = g_Gesture_Pressed;
+    released = g_Gesture_Released;
+    states   = g_Button_States;
+    g_Gesture_Pressed  = 0;
+    g_Gesture_Released = 0;
+    ResumeAllInterrupts();
+
+    /* The running timers first, they started before the new edges */
+    for(active = g_Gesture_Timing; active != 0; active &= active - 1U)
+    {
+        id = BUTTON_LOWEST_ID(active);
+        if(g_Gesture_Timer[id] > elapsed)
+        {
+            g_Gesture_Timer[id] -= (uint16)elapsed;
+        }
+        else
+        {
+            Button_GestureInput(id, BUTTON_INPUT_TIMEOUT);
+        }
+    }
+
+    /* A button with both edges since the last call was pressed then released, unless it is pressed now */
+    for(active = pressed | released; active != 0; active &= active - 1U)
+    {
+        id = BUTTON_LOWEST_ID(active);
+        if((released & BUTTON_MASK(id)) == 0)
+        {
+            Button_GestureInput(id, BUTTON_INPUT_PRESS);
+        }
+        else if((pressed & BUTTON_MASK(id)) == 0)
+        {
+            Button_GestureInput(id, BUTTON_INPUT_RELEASE);
+        }
+        else if((states & BUTTON_MASK(id)) != 0)
+        {
+            Button_GestureInput(id, BUTTON_INPUT_RELEASE);
+            Button_GestureInput(id, BUTTON_INPUT_PRESS);
+        }
+        else
+        {
+            Button_GestureInput(id, BUTTON_INPUT_PRESS);
+            Button_GestureInput(id, BUTTON_INPUT_RELEASE);
+        }
+    }
+
+    if((write != g_Gesture_Write) && (g_Gesture_Notification != NULL_PTR))
+    {
+        (*g_Gesture_Notification)();
+    }
+}
+
+/*******************************************************************************************************************/
+boolean Button_GestureIsActive(void)
+{
+    return (boolean)((g_Gesture_Timing | g_Gesture_Pressed | g_Gesture_Released) != 0);
+}
+
+/*******************************************************************************************************************/
+Std_ReturnType Button_ReadGesture(Button_GestureEventType * Event)
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint8 read = g_Gesture_Read;
+
+    if(read != g_Gesture_Write)
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        *Event = g_Gesture_Queue[read % BUTTON_GESTURE_QUEUE_SIZE];
+        g_Gesture_Read = (uint8)(read + 1U);
+        status = E_OK;
     }
+    return status;
 }
 /*******************************************************************************************************************/
@@ -12,23 +12,125 @@
 #define BUTTON_H
 
 #include "Std_Types.h"
+#include "Dio.h"
+#include "Icu.h"
 #include "Button_Cfg.h"
 
+/* Number of the consecutive samples with the same new level needed to change the state of a button */
+#define BUTTON_DEBOUNCE_SAMPLES    (3U)
+
+/* Bit of the button in the state and edge masks */
+#define BUTTON_MASK(ID)            ((uint32)1U << (ID))
+
+/* Gestures reported by Button_ReadGesture */
+#define BUTTON_GESTURE_NONE          ((Button_GestureType)0U)
+#define BUTTON_GESTURE_CLICK         ((Button_GestureType)1U)
+#define BUTTON_GESTURE_DOUBLE_CLICK  ((Button_GestureType)2U)
+#define BUTTON_GESTURE_LONG_PRESS    ((Button_GestureType)3U)
+#define BUTTON_GESTURE_REPEAT        ((Button_GestureType)4U)
+#define BUTTON_GESTURE_CHORD         ((Button_GestureType)5U)
+
+/* Type definition for the Id of a button (index in Button_PBcfg.c) */
+typedef uint8 Button_IdType;
+
+/* Type definition for the gestures (BUTTON_GESTURE_xxx) */
+typedef uint8 Button_GestureType;
+
+/* Description: Structure to hold a gesture event:
+ *  1. the gesture
+ *  2. the Id of the button, or the index of the chord in Button_PBcfg.c for BUTTON_GESTURE_CHORD
+ */
+typedef struct
+{
+    Button_GestureType Gesture;
+    uint8 Id;
+}Button_GestureEventType;
+
+/* Description: Structure to configure each button:
+ *  1. the Dio Port and the pin number of the input
+ *  2. the level of the input while the button is pressed (STD_LOW with a pull up)
+ *  3. the Icu channel notifying the edges of the pin (interrupt mode)
+ */
+typedef struct
+{
+    Dio_PortType Port;
+    Dio_ChannelType Pin;
+    Dio_LevelType PressedLevel;
+    Icu_ChannelType IcuChannel;
+}Button_PinConfigType;
+
+/* Data Structure required for initializing the Button Module:
+ *  1. the configured buttons
+ *  2. the function called when the state of a button changes (NULL_PTR if not used), in interrupt mode
+ *     it is called from the debounce timer interrupt
+ *  3. the masks of the buttons of each chord (BUTTON_NUMBER_OF_CHORDS, NULL_PTR if there are none)
+ *  4. the function called when Button_GestureTick queues gesture events (NULL_PTR if not used)
+ */
+typedef struct
+{
+    Button_PinConfigType Buttons[BUTTON_NUMBER_OF_BUTTONS];
+    void (*ChangeNotification)(void);
+    const uint32 * Chords;
+    void (*GestureNotification)(void);
+}Button_ConfigType;
+
 /* 
- * Description: 1. Fill the button configurations structure 
- *              2. Set the PIN direction which the button is connected as INPUT pin
- *              3. Set the pin internal resistor
+ * Description: Prepare the masks of the sampled ports from the configured buttons,
+ *              the pins are configured as inputs by Port, all the buttons start released.
+ *              It enables the Icu notification of the buttons, Icu (and Gpt in interrupt mode)
+ *              must be initialized before.
  */
-void Button_init();
+void Button_Init(const Button_ConfigType * ConfigPtr);
 
 /* Description: Read the Button state Pressed/Released */
-uint8 Button_GetState(void);
+uint8 Button_GetState(Button_IdType ButtonId);
+
+/* Description: Read the state of all the buttons, bit set --> pressed */
+uint32 Button_GetStates(void);
+
+/* Description: Read then clear the buttons pressed and released since the last call (bit set --> edge) */
+void Button_ReadEdges(uint32 * Pressed, uint32 * Released);
+
+/* Description: Return TRUE while the last sample of a button differs from its state (a new state is not confirmed yet) */
+boolean Button_IsDebouncing(void);
 
 /* 
- * Description: This function is called every 20ms by Os Task and it responsible for Updating 
- *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
- *		        and it should be in a RELEASED State if the button is released for 60ms.
+ * Description: This function is called by the Button Os Task and it responsible for Updating 
+ *              the BUTTONS State. Each configured port is read once, all the buttons are debounced
+ *              together with vertical counters, a button changes its state after BUTTON_DEBOUNCE_SAMPLES
+ *              consecutive samples at the new level.
  */   
 void Button_RefreshState(void);
 
+/*
+ * Description: Run the gesture state machines of the buttons from the edges since the last call and the time
+ *              measured on BUTTON_GESTURE_COUNTER, the gestures are queued for Button_ReadGesture.
+ *              It must be called on each tick of the counter while Button_GestureIsActive returns TRUE,
+ *              and after the button state changes. Only the buttons with an edge or a running timer are processed.
+ */
+void Button_GestureTick(void);
+
+/* Description: Return TRUE while a gesture needs Button_GestureTick (an edge not processed yet or a running timer) */
+boolean Button_GestureIsActive(void);
+
+/* Description: Read the oldest queued gesture event, E_NOT_OK if the queue is empty */
+Std_ReturnType Button_ReadGesture(Button_GestureEventType * Event);
+
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+/*
+ * Description: Called from the Icu notification of a button on its first edge, it masks the Icu channel
+ *              of the button so the bounces do not interrupt, then starts the debounce timer
+ */
+void Button_EdgeNotification(Button_IdType ButtonId);
+
+/*
+ * Description: Gpt notification of the debounce timer, the level of the buttons masked since its start is
+ *              read once: a button at a new level changes its state, then their Icu channels are unmasked
+ */
+void Button_DebounceNotification(void);
+#endif
+
+/* Button configuration structure in Button_PBcfg.c */
+extern const Button_ConfigType Button_Configuration;
+
 #endif /* BUTTON_H */
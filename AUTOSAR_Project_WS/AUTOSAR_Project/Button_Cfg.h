@@ -12,15 +12,43 @@
 #ifndef BUTTON_CFG_H_
 #define BUTTON_CFG_H_
 
-/* Button State according to its configuration PULL UP/Down */
+/* Button State returned by Button_GetState */
 #define BUTTON_PRESSED  STD_LOW
 #define BUTTON_RELEASED STD_HIGH
 
-/* Set the Button Port */
-#define BUTTON_PORT DioConf_SW1_PORT_NUM
+/* Number of the buttons in Button_PBcfg.c (32 maximum, one bit of the state and edge masks each) */
+#define BUTTON_NUMBER_OF_BUTTONS   (1U)
 
-/* Set the Button Pin Number */
-#define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
+/* Button Index in the array of structures in Button_PBcfg.c (bit of the button in the masks) */
+#define ButtonConf_SW1             (Button_IdType)0
 
+/* Pre-compile option for the interrupt driven buttons: the first edge of a button masks its Icu channel and
+ * starts the one-shot debounce timer, the level is confirmed when it expires (no polling Button Task) */
+#define BUTTON_INTERRUPT_MODE      (STD_ON)
+
+/* Time from the first edge of a button to the confirmation of its new level (interrupt mode) */
+#define BUTTON_DEBOUNCE_TIME_MS    (30U)
+
+/* Gpt channel used as the one-shot debounce timer, it counts the system clock (interrupt mode) */
+#define BUTTON_DEBOUNCE_GPT_CHANNEL  GptConf_BUTTON_DEBOUNCE_CHANNEL_ID_INDEX
+
+/* Number of the chords in Button_PBcfg.c (buttons pressed together reported as one gesture) */
+#define BUTTON_NUMBER_OF_CHORDS    (0U)
+
+/* Os counter read by Button_GestureTick to measure the time between its calls, and its tick in ms */
+#define BUTTON_GESTURE_COUNTER     OS_COUNTER_SYSTEM
+#define BUTTON_GESTURE_TICK_MS     (20U)
+
+/* Gesture timing thresholds in ms:
+ *  - a button held for BUTTON_LONG_PRESS_MS reports a long press, then a repeat every BUTTON_REPEAT_PERIOD_MS
+ *  - a second press less than BUTTON_DOUBLE_CLICK_MS after a short press reports a double-click,
+ *    a single click is reported when this time elapses without a second press
+ */
+#define BUTTON_LONG_PRESS_MS       (800U)
+#define BUTTON_REPEAT_PERIOD_MS    (200U)
+#define BUTTON_DOUBLE_CLICK_MS     (300U)
+
+/* Number of the gesture events queued for the App (power of 2), a new event is dropped when it is full */
+#define BUTTON_GESTURE_QUEUE_SIZE  (8U)
 
 #endif /* BUTTON_CFG_H_ */
@@ -0,0 +1,23 @@
+/******************************************************************************
+ *
+ * Module: Button
+ *
+ * File Name: Button_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Button Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Button.h"
+#include "App.h"
+
+/* PB structure used with Button_Init API */
+const Button_ConfigType Button_Configuration = {
+                                                   {
+                                                       {DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, STD_LOW, IcuConf_SW1_CHANNEL_ID_INDEX}   /* ButtonConf_SW1 ... pull up */
+                                                   },
+                                                   App_ButtonChangeNotification,
+                                                   NULL_PTR,                       /* No chord (BUTTON_NUMBER_OF_CHORDS) */
+                                                   App_GestureNotification
+                                               };
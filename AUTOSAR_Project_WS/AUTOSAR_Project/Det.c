@@ -10,16 +10,178 @@
  ******************************************************************************/
 
 #include "Det.h"
+#include "Os.h"
+#include "tm4c123gh6pm_registers.h"
 
+/* Module Ids with their own error counter */
+static const uint16 g_Counted_Module_Ids[DET_NUMBER_OF_COUNTED_MODULES] = DET_COUNTED_MODULE_IDS;
+
+/* Ring buffer of the error records, the indexes are free running and wrap with the uint32 type */
+static Det_ErrorRecordType g_Error_Buffer[DET_BUFFER_SIZE];
+static uint32 g_Write_Index = 0;
+static uint32 g_Read_Index = 0;
+
+/* Number of the records overwritten before they were read */
+static uint32 g_Lost_Count = 0;
+
+/* Number of the errors reported by each counted module, the last entry counts the other modules */
+static uint32 g_Error_Count[DET_NUMBER_OF_COUNTED_MODULES + 1];
+
+/* Open addressing hash table of the aggregated errors, an entry with a zero Count is empty */
+static Det_ErrorSummaryType g_Error_Summary[DET_AGGREGATION_SIZE];
+
+/*********************************************************************************************/
+/* Description: Return the index of the error counter of a module, DET_NUMBER_OF_COUNTED_MODULES for the
+ *              shared counter of the other modules */
+static uint8 Det_CounterIndex(uint16 ModuleId)
+{
+    uint8 index;
+
+    for(index = 0; index < DET_NUMBER_OF_COUNTED_MODULES; index++)
+    {
+        if(g_Counted_Module_Ids[index] == ModuleId)
+        {
+            break;
+        }
+    }
+    return index;
+}
+
+/*********************************************************************************************/
+/* Description: Count the report in the entry of the error, a new error takes the first empty entry from
+ *              its hash position, TRUE is returned if the report is the first one of the error or if the
+ *              table is full so it is appended to the ring buffer */
+static boolean Det_Aggregate(uint16 ModuleId, uint8 ApiId, uint8 ErrorId, uint32 Timestamp)
+{
+    uint32 key = ((uint32)ModuleId << 16) | ((uint32)ApiId << 8) | ErrorId;
+    uint8 slot = (uint8)(((key * 0x9E3779B1UL) >> 24) % DET_AGGREGATION_SIZE);
+    Det_ErrorSummaryType * entry;
+    uint8 probe;
+    boolean first_report = TRUE;    /* Also kept when the table is full of other errors */
+
+    for(probe = 0; probe < DET_AGGREGATION_SIZE; probe++)
+    {
+        entry = &g_Error_Summary[slot];
+        if(entry->Count == 0)
+        {
+            entry->ModuleId       = ModuleId;
+            entry->ApiId          = ApiId;
+            entry->ErrorId        = ErrorId;
+            entry->Count          = 1;
+            entry->FirstTimestamp = Timestamp;
+            entry->LastTimestamp  = Timestamp;
+            break;
+        }
+        else if((entry->ModuleId == ModuleId) && (entry->ApiId == ApiId) && (entry->ErrorId == ErrorId))
+        {
+            if(entry->Count != 0xFFFFFFFFUL)
+            {
+                entry->Count++;
+            }
+            entry->LastTimestamp = Timestamp;
+            first_report = FALSE;
+            break;
+        }
+        else
+        {
+            slot = (uint8)((slot + 1) % DET_AGGREGATION_SIZE);
+        }
+    }
+    return first_report;
+}
+
+/*********************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId )
 {
+    Det_ErrorRecordType * record;
+    uint8 counter = Det_CounterIndex(ModuleId);
+    uint32 timestamp;
+
+    /* Short critical section, the callers may be preempted by an interrupt which reports an error too */
+    SuspendAllInterrupts();
+
+    timestamp = DWT_CYCCNT_REG;
+
+    /* The repeated reports of an error only update its aggregated entry */
+    if(Det_Aggregate(ModuleId, ApiId, ErrorId, timestamp) == TRUE)
+    {
+        if((g_Write_Index - g_Read_Index) >= DET_BUFFER_SIZE)
+        {
+            /* Full: the oldest record is dropped so the latest errors are always kept */
+            g_Read_Index++;
+            g_Lost_Count++;
+        }
+        record = &g_Error_Buffer[g_Write_Index % DET_BUFFER_SIZE];
+        record->Timestamp  = timestamp;
+        record->ModuleId   = ModuleId;
+        record->InstanceId = InstanceId;
+        record->ApiId      = ApiId;
+        record->ErrorId    = ErrorId;
+        g_Write_Index++;
+    }
+
+    g_Error_Count[counter]++;
+
+#if (DET_HALT_ON_ERROR == STD_ON)
+    /* Keep the interrupts disabled and stop here for the debugger */
     while(1)
     {
 
     }
+#else
+    ResumeAllInterrupts();
+#endif
     return E_OK;
 }
 
+/*********************************************************************************************/
+Std_ReturnType Det_ReadError(Det_ErrorRecordType * Record)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(Record != NULL_PTR)
+    {
+        SuspendAllInterrupts();
+        if(g_Read_Index != g_Write_Index)
+        {
+            *Record = g_Error_Buffer[g_Read_Index % DET_BUFFER_SIZE];
+            g_Read_Index++;
+            ret = E_OK;
+        }
+        ResumeAllInterrupts();
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+uint32 Det_GetErrorCount(uint16 ModuleId)
+{
+    return g_Error_Count[Det_CounterIndex(ModuleId)];
+}
+
+/*********************************************************************************************/
+uint32 Det_GetLostCount(void)
+{
+    return g_Lost_Count;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Det_GetErrorSummary(uint8 Index, Det_ErrorSummaryType * Summary)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((Summary != NULL_PTR) && (Index < DET_AGGREGATION_SIZE))
+    {
+        SuspendAllInterrupts();
+        if(g_Error_Summary[Index].Count != 0)
+        {
+            *Summary = g_Error_Summary[Index];
+            ret = E_OK;
+        }
+        ResumeAllInterrupts();
+    }
+    return ret;
+}
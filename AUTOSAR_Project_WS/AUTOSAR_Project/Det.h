@@ -46,12 +46,78 @@
 #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+/* AUTOSAR Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_AR_MAJOR_VERSION != DET_AR_MAJOR_VERSION)\
+    || (DET_CFG_AR_MINOR_VERSION != DET_AR_MINOR_VERSION)\
+    || (DET_CFG_AR_PATCH_VERSION != DET_AR_PATCH_VERSION))
+#error "The AR version of Det_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_SW_MAJOR_VERSION != DET_SW_MAJOR_VERSION)\
+    || (DET_CFG_SW_MINOR_VERSION != DET_SW_MINOR_VERSION)\
+    || (DET_CFG_SW_PATCH_VERSION != DET_SW_PATCH_VERSION))
+#error "The SW version of Det_Cfg.h does not match the expected version"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure of an error record:
+ *  1. core cycle counter (DWT CYCCNT) when the error was reported
+ *  2. the arguments of Det_ReportError
+ */
+typedef struct
+{
+    uint32 Timestamp;
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+}Det_ErrorRecordType;
+
+/* Description: Structure of an aggregated error, all the reports of the same (ModuleId, ApiId, ErrorId):
+ *  1. the error
+ *  2. number of reports (saturated at 0xFFFFFFFF)
+ *  3. core cycle counter of the first and of the last report
+ */
+typedef struct
+{
+    uint16 ModuleId;
+    uint8 ApiId;
+    uint8 ErrorId;
+    uint32 Count;
+    uint32 FirstTimestamp;
+    uint32 LastTimestamp;
+}Det_ErrorSummaryType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+
+/* Description: Count the error in its aggregated entry, the first report of an error (or each report when
+ *              the aggregation table is full) is appended to the ring buffer, it can be called from the
+ *              tasks and the interrupts, it returns unless DET_HALT_ON_ERROR is STD_ON */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId );
 
+/* Description: Read and remove the oldest error record of the ring buffer, E_NOT_OK if it is empty */
+Std_ReturnType Det_ReadError(Det_ErrorRecordType * Record);
+
+/* Description: Return the number of errors reported by a module since reset (modules without their
+ *              own counter share one counter) */
+uint32 Det_GetErrorCount(uint16 ModuleId);
+
+/* Description: Return the number of error records overwritten before they were read */
+uint32 Det_GetLostCount(void);
+
+/* Description: Read an entry of the aggregation table (0 .. DET_AGGREGATION_SIZE-1), E_NOT_OK if it is empty */
+Std_ReturnType Det_GetErrorSummary(uint8 Index, Det_ErrorSummaryType * Summary);
+
 #endif /* DET_H */
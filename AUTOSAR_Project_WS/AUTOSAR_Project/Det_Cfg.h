@@ -0,0 +1,48 @@
+/******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Det module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DET_CFG_SW_MAJOR_VERSION              (1U)
+#define DET_CFG_SW_MINOR_VERSION              (0U)
+#define DET_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DET_CFG_AR_MAJOR_VERSION              (4U)
+#define DET_CFG_AR_MINOR_VERSION              (0U)
+#define DET_CFG_AR_PATCH_VERSION              (3U)
+
+/* Number of the error records kept in the ring buffer (power of 2), the oldest unread record
+ * is overwritten when it is full */
+#define DET_BUFFER_SIZE                       (32U)
+
+/* Number of the distinct (ModuleId, ApiId, ErrorId) errors aggregated in the hash table (power of 2),
+ * only the first report of an aggregated error is appended to the ring buffer */
+#define DET_AGGREGATION_SIZE                  (16U)
+
+/* Pre-compile option to stop in Det_ReportError with the interrupts disabled after recording
+ * the error (the error is then examined with the debugger) */
+#define DET_HALT_ON_ERROR                     (STD_OFF)
+
+/* Number of the modules with their own error counter, the errors of the other modules are
+ * counted together */
+#define DET_NUMBER_OF_COUNTED_MODULES         (10U)
+
+/* Module Ids with their own error counter: Os, Gpt, Mcu, Dio (and Port), Pwm, Icu, Uart, SwPwm, Fault, Irq */
+#define DET_COUNTED_MODULE_IDS                { 1U, 100U, 101U, 120U, 121U, 122U, 252U, 253U, 254U, 255U }
+
+#endif /* DET_CFG_H */
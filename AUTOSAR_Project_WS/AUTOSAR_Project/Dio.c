@@ -12,6 +12,11 @@
 #include "Dio.h"
 #include "Dio_Regs.h"
 
+#if (DIO_WARM_BOOT_API == STD_ON)
+#include "Os.h"
+#include "NoInit.h"
+#endif
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
 #include "Det.h"
@@ -27,6 +32,66 @@
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* Data registers of the GPIO Ports indexed by the Port Id */
+STATIC volatile uint32 * const Dio_PortDataRegs[DIO_NUMBER_OF_PORTS] =
+{
+	&GPIO_PORTA_DATA_REG, &GPIO_PORTB_DATA_REG, &GPIO_PORTC_DATA_REG,
+	&GPIO_PORTD_DATA_REG, &GPIO_PORTE_DATA_REG, &GPIO_PORTF_DATA_REG
+};
+
+#if (DIO_WARM_BOOT_API == STD_ON)
+/* Description: Structure of the output levels kept across the software and watchdog resets:
+ *  1. DIO_WARM_BOOT_SIGNATURE once the record is initialized
+ *  2. the last level written on each channel of each port
+ *  3. the channels written by Dio in each port, the other pins are left as configured by Port
+ *  4. the checksum of the record, a write interrupted by a reset leaves it invalid
+ */
+typedef struct
+{
+	uint32 Signature;
+	uint8 Levels[DIO_NUMBER_OF_PORTS];
+	uint8 Written[DIO_NUMBER_OF_PORTS];
+	uint32 Checksum;
+} Dio_OutputRecordType;
+
+#define DIO_RECORD_WORDS               NOINIT_RECORD_WORDS(Dio_OutputRecordType)
+
+#pragma DATA_SECTION(Dio_OutputRecord, ".noinit")
+STATIC Dio_OutputRecordType Dio_OutputRecord;
+
+/************************************************************************************
+* Description: Save the level written on a channel in the output record, the record and its
+*              checksum are updated together as the channels are written from preempting tasks and ISRs
+************************************************************************************/
+STATIC void Dio_SaveOutput(Dio_PortType PortId, Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	SuspendAllInterrupts();
+	if(Level == STD_HIGH)
+	{
+		SET_BIT(Dio_OutputRecord.Levels[PortId], ChannelId);
+	}
+	else
+	{
+		CLEAR_BIT(Dio_OutputRecord.Levels[PortId], ChannelId);
+	}
+	SET_BIT(Dio_OutputRecord.Written[PortId], ChannelId);
+	NoInit_Seal((uint32 *)&Dio_OutputRecord, DIO_RECORD_WORDS, DIO_WARM_BOOT_SIGNATURE);
+	ResumeAllInterrupts();
+}
+
+/************************************************************************************
+* Description: Save the levels written on a whole port in the output record
+************************************************************************************/
+STATIC void Dio_SavePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	SuspendAllInterrupts();
+	Dio_OutputRecord.Levels[PortId]  = Level;
+	Dio_OutputRecord.Written[PortId] = 0xFF;
+	NoInit_Seal((uint32 *)&Dio_OutputRecord, DIO_RECORD_WORDS, DIO_WARM_BOOT_SIGNATURE);
+	ResumeAllInterrupts();
+}
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -56,6 +121,20 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		 */
 		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+#if (DIO_WARM_BOOT_API == STD_ON)
+		/* A valid record is kept for Dio_RestoreOutputs, otherwise (power-on) it starts empty */
+		if(FALSE == NoInit_IsValid((const uint32 *)&Dio_OutputRecord, DIO_RECORD_WORDS, DIO_WARM_BOOT_SIGNATURE))
+		{
+			uint8 port;
+			for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+			{
+				Dio_OutputRecord.Levels[port]  = 0;
+				Dio_OutputRecord.Written[port] = 0;
+			}
+			NoInit_Seal((uint32 *)&Dio_OutputRecord, DIO_RECORD_WORDS, DIO_WARM_BOOT_SIGNATURE);
+		}
+#endif
 	}
 }
 
@@ -131,6 +210,9 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 			/* Write Logic Low */
 			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
 		}
+#if (DIO_WARM_BOOT_API == STD_ON)
+		Dio_SaveOutput(Dio_PortChannels[ChannelId].Port_Num, Dio_PortChannels[ChannelId].Ch_Num, Level);
+#endif
 	}
 	else
 	{
@@ -218,6 +300,116 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all the channels of a port with a single
+*              register read (bit n --> pin n).
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = (Dio_PortLevelType)*Dio_PortDataRegs[PortId];
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written (bit n --> pin n).
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of all the channels of a port with a single register
+*              write, the bits of the input pins have no effect.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		*Dio_PortDataRegs[PortId] = Level;
+#if (DIO_WARM_BOOT_API == STD_ON)
+		Dio_SavePort(PortId, Level);
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -331,6 +523,9 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
 			output = STD_HIGH;
 		}
+#if (DIO_WARM_BOOT_API == STD_ON)
+		Dio_SaveOutput(Dio_PortChannels[ChannelId].Port_Num, Dio_PortChannels[ChannelId].Ch_Num, output);
+#endif
 	}
 	else
 	{
@@ -339,3 +534,41 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
         return output;
 }
 #endif
+
+#if (DIO_WARM_BOOT_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_RestoreOutputs
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the saved levels are written back,
+*                                E_NOT_OK if the output record is not valid
+* Description: Function to write back the last levels written by Dio before a software or
+*              watchdog reset. It is called after Port_PreloadOutputLevels and before PORT_Init,
+*              so the GPIODATA registers hold the levels before the pins become outputs.
+*              Only the channels written by Dio are changed.
+************************************************************************************/
+Std_ReturnType Dio_RestoreOutputs(void)
+{
+	Std_ReturnType ret = E_NOT_OK;
+	uint8 port;
+	uint8 written;
+
+	if(TRUE == NoInit_IsValid((const uint32 *)&Dio_OutputRecord, DIO_RECORD_WORDS, DIO_WARM_BOOT_SIGNATURE))
+	{
+		for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+		{
+			written = Dio_OutputRecord.Written[port];
+			if(written != 0)
+			{
+				*Dio_PortDataRegs[port] = (*Dio_PortDataRegs[port] & ~(uint32)written)
+				                        | (Dio_OutputRecord.Levels[port] & written);
+			}
+		}
+		ret = E_OK;
+	}
+	return ret;
+}
+#endif
@@ -102,6 +102,12 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Number of the GPIO Ports (PORTA to PORTF) */
+#define DIO_NUMBER_OF_PORTS            (6U)
+
+/* Signature of a valid output record in the .noinit RAM section */
+#define DIO_WARM_BOOT_SIGNATURE        (0x57A4B007UL)
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -173,16 +179,16 @@ typedef struct Dio_ConfigType
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
 /* Function for DIO Initialization API */
@@ -193,6 +199,11 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr);
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 #endif
 
+#if (DIO_WARM_BOOT_API == STD_ON)
+/* Function to write back the output levels saved before a software or watchdog reset */
+Std_ReturnType Dio_RestoreOutputs(void);
+#endif
+
 /* Function for DIO Get Version Info API */
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
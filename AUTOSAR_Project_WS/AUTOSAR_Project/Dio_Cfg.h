@@ -35,6 +35,9 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for the output levels kept in the .noinit RAM section for a warm boot (Dio_RestoreOutputs) */
+#define DIO_WARM_BOOT_API                   (STD_ON)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -0,0 +1,222 @@
+ /******************************************************************************
+ *
+ * Module: Fault
+ *
+ * File Name: Fault.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Fault Handler
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Fault.h"
+#include "Fault_Regs.h"
+#include "Mcu_Regs.h"
+#include "Common_Macros.h"
+#include "NoInit.h"
+
+#if (FAULT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Fault Modules */
+#if ((DET_AR_MAJOR_VERSION != FAULT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != FAULT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != FAULT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#define FAULT_RECORD_WORDS           NOINIT_RECORD_WORDS(Fault_RecordType)
+
+#pragma DATA_SECTION(Fault_Record, ".noinit")
+STATIC Fault_RecordType Fault_Record;
+
+void Fault_Capture(const uint32 * Frame, uint32 ExcReturn, uint32 Exception);
+
+/*
+ * Entry of the fault vectors: the exception frame is on the stack selected by bit 2 of EXC_RETURN
+ * (MSP or PSP), its address, EXC_RETURN and the exception number are passed to Fault_Capture
+ * before any C code uses the stack.
+ */
+__asm("        .text\n"
+      "        .thumb\n"
+      "        .align  2\n"
+      "        .global Fault_Handler\n"
+      "        .global Fault_Capture\n"
+      "        .thumbfunc Fault_Handler\n"
+      "Fault_Handler:\n"
+      "        tst     lr, #4\n"
+      "        ite     eq\n"
+      "        mrseq   r0, msp\n"
+      "        mrsne   r0, psp\n"
+      "        mov     r1, lr\n"
+      "        mrs     r2, ipsr\n"
+      "        b.w     Fault_Capture\n");
+
+/************************************************************************************
+* Description: Return TRUE if the words from Address are inside the SRAM
+************************************************************************************/
+STATIC boolean Fault_InSram(uint32 Address, uint32 Words)
+{
+    return (boolean)((Address >= FAULT_SRAM_START) && ((Address & 0x3U) == 0U)
+                  && (Address <= (FAULT_SRAM_END - (Words * sizeof(uint32)))));
+}
+
+/************************************************************************************
+* Description: Save the crash record then reset the device, called by Fault_Handler with
+*              the address of the exception frame. The count of the previous valid record
+*              is kept so repeated faults are visible after the reset.
+************************************************************************************/
+void Fault_Capture(const uint32 * Frame, uint32 ExcReturn, uint32 Exception)
+{
+    uint32 frame_words = FAULT_BASIC_FRAME_WORDS;
+    uint32 address;
+    uint8 index;
+
+    if(TRUE == NoInit_IsValid((const uint32 *)&Fault_Record, FAULT_RECORD_WORDS, FAULT_RECORD_SIGNATURE))
+    {
+        Fault_Record.Count++;
+    }
+    else
+    {
+        Fault_Record.Count = 1;
+    }
+    Fault_Record.Exception = Exception & 0x1FFU;
+    Fault_Record.ExcReturn = ExcReturn;
+    Fault_Record.Cfsr      = FAULT_SCB_CFSR_REG;
+    Fault_Record.Hfsr      = FAULT_SCB_HFSR_REG;
+    Fault_Record.Mmfar     = FAULT_SCB_MMFAR_REG;
+    Fault_Record.Bfar      = FAULT_SCB_BFAR_REG;
+
+    /* A stacking fault leaves the frame pointer outside the SRAM, it is not read then */
+    if(TRUE == Fault_InSram((uint32)Frame, FAULT_FRAME_WORDS))
+    {
+        for(index = 0; index < FAULT_FRAME_WORDS; index++)
+        {
+            Fault_Record.Frame[index] = Frame[index];
+        }
+        if(BIT_IS_CLEAR(ExcReturn, FAULT_EXC_RETURN_STD_FRAME_BIT))
+        {
+            frame_words = FAULT_FPU_FRAME_WORDS;
+        }
+        if(BIT_IS_SET(Fault_Record.Frame[FAULT_FRAME_XPSR], FAULT_XPSR_STACK_ALIGN_BIT))
+        {
+            frame_words++;
+        }
+    }
+    else
+    {
+        for(index = 0; index < FAULT_FRAME_WORDS; index++)
+        {
+            Fault_Record.Frame[index] = 0;
+        }
+    }
+
+    /* Stack of the interrupted code, as it was before the exception entry */
+    address = (uint32)Frame + (frame_words * sizeof(uint32));
+    Fault_Record.StackPointer = address;
+    for(index = 0; index < FAULT_STACK_WINDOW_WORDS; index++)
+    {
+        if(TRUE == Fault_InSram(address, 1U))
+        {
+            Fault_Record.Stack[index] = *(const uint32 *)address;
+        }
+        else
+        {
+            Fault_Record.Stack[index] = 0;
+        }
+        address += sizeof(uint32);
+    }
+    NoInit_Seal((uint32 *)&Fault_Record, FAULT_RECORD_WORDS, FAULT_RECORD_SIGNATURE);
+
+#if (FAULT_RESET_AFTER_CAPTURE == STD_ON)
+    MCU_SCB_APINT_REG = MCU_SCB_APINT_VECTKEY | (1UL << MCU_SCB_APINT_SYSRESREQ_BIT);
+#endif
+    /* Wait for the reset or for the debugger */
+    while(1);
+}
+
+/************************************************************************************
+* Service Name: Fault_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the MemManage, BusFault and UsageFault exceptions, without
+*              it these faults are escalated to HardFault and their cause is less precise.
+************************************************************************************/
+void Fault_Init(void)
+{
+    FAULT_SCB_SHCSR_REG |= (1UL << FAULT_SCB_SHCSR_MEMFAULTENA_BIT)
+                         | (1UL << FAULT_SCB_SHCSR_BUSFAULTENA_BIT)
+                         | (1UL << FAULT_SCB_SHCSR_USGFAULTENA_BIT);
+}
+
+/************************************************************************************
+* Service Name: Fault_GetRecord
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Record - Copy of the crash record
+* Return value: Std_ReturnType - E_OK if a valid crash record was saved before the reset
+* Description: Function to read the crash record, it can be sent to the host and printed
+*              by Tools/Fault_Decode.
+************************************************************************************/
+Std_ReturnType Fault_GetRecord(Fault_RecordType * Record)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+#if (FAULT_DEV_ERROR_DETECT == STD_ON)
+    if (NULL_PTR == Record)
+    {
+        Det_ReportError(FAULT_MODULE_ID, FAULT_INSTANCE_ID, FAULT_GET_RECORD_SID, FAULT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        if(TRUE == NoInit_IsValid((const uint32 *)&Fault_Record, FAULT_RECORD_WORDS, FAULT_RECORD_SIGNATURE))
+        {
+            *Record = Fault_Record;
+            ret = E_OK;
+        }
+    }
+    return ret;
+}
+
+/************************************************************************************
+* Service Name: Fault_ClearRecord
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to invalidate the crash record, the next fault count starts from 1.
+************************************************************************************/
+void Fault_ClearRecord(void)
+{
+    Fault_Record.Signature = 0;
+}
+
+/************************************************************************************
+* Service Name: Fault_IsRecordValid
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if a valid crash record was saved before the reset
+* Description: Function to check the crash record when only its presence is reported.
+************************************************************************************/
+boolean Fault_IsRecordValid(void)
+{
+    return NoInit_IsValid((const uint32 *)&Fault_Record, FAULT_RECORD_WORDS, FAULT_RECORD_SIGNATURE);
+}
@@ -0,0 +1,143 @@
+ /******************************************************************************
+ *
+ * Module: Fault
+ *
+ * File Name: Fault.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Fault Handler, it saves a crash
+ *              record of the HardFault, MemManage, BusFault and UsageFault exceptions in the
+ *              .noinit RAM section then resets the device. Tools/Fault_Decode prints the record.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef FAULT_H
+#define FAULT_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define FAULT_VENDOR_ID    (1000U)
+
+/* Fault Module Id (Complex Driver) */
+#define FAULT_MODULE_ID    (254U)
+
+/* Fault Instance Id */
+#define FAULT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define FAULT_SW_MAJOR_VERSION           (1U)
+#define FAULT_SW_MINOR_VERSION           (0U)
+#define FAULT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define FAULT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define FAULT_AR_RELEASE_MINOR_VERSION   (0U)
+#define FAULT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Fault Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != FAULT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != FAULT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != FAULT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Fault Pre-Compile Configuration Header file */
+#include "Fault_Cfg.h"
+
+/* AUTOSAR Version checking between Fault_Cfg.h and Fault.h files */
+#if ((FAULT_CFG_AR_RELEASE_MAJOR_VERSION != FAULT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (FAULT_CFG_AR_RELEASE_MINOR_VERSION != FAULT_AR_RELEASE_MINOR_VERSION)\
+ ||  (FAULT_CFG_AR_RELEASE_PATCH_VERSION != FAULT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Fault_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Fault_Cfg.h and Fault.h files */
+#if ((FAULT_CFG_SW_MAJOR_VERSION != FAULT_SW_MAJOR_VERSION)\
+ ||  (FAULT_CFG_SW_MINOR_VERSION != FAULT_SW_MINOR_VERSION)\
+ ||  (FAULT_CFG_SW_PATCH_VERSION != FAULT_SW_PATCH_VERSION))
+  #error "The SW version of Fault_Cfg.h does not match the expected version"
+#endif
+
+/* Signature of a valid crash record (FAULT_RECORD_SIGNATURE in Tools/Fault_Decode) */
+#define FAULT_RECORD_SIGNATURE         (0xFA017C0DUL)
+
+/* Index of each register in the exception frame saved in the crash record */
+#define FAULT_FRAME_R0                 (0U)
+#define FAULT_FRAME_R1                 (1U)
+#define FAULT_FRAME_R2                 (2U)
+#define FAULT_FRAME_R3                 (3U)
+#define FAULT_FRAME_R12                (4U)
+#define FAULT_FRAME_LR                 (5U)
+#define FAULT_FRAME_PC                 (6U)
+#define FAULT_FRAME_XPSR               (7U)
+#define FAULT_FRAME_WORDS              (8U)
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for FAULT Get Record */
+#define FAULT_GET_RECORD_SID           (uint8)0x01
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called with a NULL pointer */
+#define FAULT_E_PARAM_POINTER          (uint8)0x0A
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure of the crash record kept across the reset (all words, the host tool reads it
+ *              as an array of little-endian 32-bit words in this order):
+ *  1. FAULT_RECORD_SIGNATURE when the record is valid
+ *  2. number of faults captured since the record was cleared
+ *  3. exception number (3 HardFault, 4 MemManage, 5 BusFault, 6 UsageFault) and EXC_RETURN
+ *  4. registers stacked by the exception entry (R0-R3, R12, LR, PC, xPSR), 0 if the frame is outside the SRAM
+ *  5. fault status and address registers
+ *  6. stack pointer before the exception and the stack words above it (0 past the end of the SRAM)
+ *  7. checksum of the previous words
+ */
+typedef struct
+{
+    uint32 Signature;
+    uint32 Count;
+    uint32 Exception;
+    uint32 ExcReturn;
+    uint32 Frame[FAULT_FRAME_WORDS];
+    uint32 Cfsr;
+    uint32 Hfsr;
+    uint32 Mmfar;
+    uint32 Bfar;
+    uint32 StackPointer;
+    uint32 Stack[FAULT_STACK_WINDOW_WORDS];
+    uint32 Checksum;
+}Fault_RecordType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to enable the MemManage, BusFault and UsageFault exceptions so they are not escalated to HardFault */
+void Fault_Init(void);
+
+/* Function to read the crash record saved before the last reset, E_NOT_OK if there is no valid record */
+Std_ReturnType Fault_GetRecord(Fault_RecordType * Record);
+
+/* Function to invalidate the crash record once it is read */
+void Fault_ClearRecord(void);
+
+/* Function to check if a valid crash record was saved before the last reset, without copying it */
+boolean Fault_IsRecordValid(void);
+
+/* Description: Handler of the HardFault, MemManage, BusFault and UsageFault vectors (assembly entry in Fault.c) */
+void Fault_Handler(void);
+
+#endif /* FAULT_H */
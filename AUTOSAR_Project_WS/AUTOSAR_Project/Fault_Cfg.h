@@ -0,0 +1,38 @@
+ /******************************************************************************
+ *
+ * Module: Fault
+ *
+ * File Name: Fault_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Fault Handler
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef FAULT_CFG_H
+#define FAULT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define FAULT_CFG_SW_MAJOR_VERSION              (1U)
+#define FAULT_CFG_SW_MINOR_VERSION              (0U)
+#define FAULT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define FAULT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define FAULT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define FAULT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define FAULT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Number of the stack words above the exception frame saved in the crash record */
+#define FAULT_STACK_WINDOW_WORDS              (16U)
+
+/* Pre-compile option to reset the device after the capture, STD_OFF keeps it in a loop for the debugger */
+#define FAULT_RESET_AFTER_CAPTURE             (STD_ON)
+
+#endif /* FAULT_CFG_H */
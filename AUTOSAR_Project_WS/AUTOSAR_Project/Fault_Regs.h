@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: Fault
+ *
+ * File Name: Fault_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Fault Handler Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef FAULT_REGS_H
+#define FAULT_REGS_H
+
+#include "Std_Types.h"
+
+/* System Handler Control and State register, enables the configurable fault exceptions */
+#define FAULT_SCB_SHCSR_REG               (*((volatile uint32 *)0xE000ED24))
+#define FAULT_SCB_SHCSR_MEMFAULTENA_BIT   16
+#define FAULT_SCB_SHCSR_BUSFAULTENA_BIT   17
+#define FAULT_SCB_SHCSR_USGFAULTENA_BIT   18
+
+/* Configurable Fault Status, Hard Fault Status, MemManage Fault Address and Bus Fault Address registers */
+#define FAULT_SCB_CFSR_REG                (*((volatile uint32 *)0xE000ED28))
+#define FAULT_SCB_HFSR_REG                (*((volatile uint32 *)0xE000ED2C))
+#define FAULT_SCB_MMFAR_REG               (*((volatile uint32 *)0xE000ED34))
+#define FAULT_SCB_BFAR_REG                (*((volatile uint32 *)0xE000ED38))
+
+/* EXC_RETURN bit cleared when the exception frame holds the FPU registers too */
+#define FAULT_EXC_RETURN_STD_FRAME_BIT    4
+
+/* xPSR bit set when a padding word was pushed to align the exception frame on 8 bytes */
+#define FAULT_XPSR_STACK_ALIGN_BIT        9
+
+/* Size in words of the basic exception frame (R0-R3, R12, LR, PC, xPSR) and of the frame with the FPU registers */
+#define FAULT_BASIC_FRAME_WORDS           8
+#define FAULT_FPU_FRAME_WORDS             26
+
+/* SRAM bounds, the frame and the stack window are only read inside them so the capture can not fault again */
+#define FAULT_SRAM_START                  0x20000000UL
+#define FAULT_SRAM_END                    0x20008000UL
+
+#endif /* FAULT_REGS_H */
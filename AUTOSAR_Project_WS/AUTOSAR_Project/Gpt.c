@@ -4,21 +4,121 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver over the General-Purpose Timers
+ *              and the SysTick Timer used by the Os.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Gpt_Regs.h"
+#include "Mcu.h"
+#include "Irq.h"
 #include "tm4c123gh6pm_registers.h"
 
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Number of the General-Purpose Timers blocks (6 16/32-bit timers then 6 32/64-bit wide timers) */
+#define GPT_NUMBER_OF_HW_TIMERS    (12U)
+
+/* Channel Id stored for a hardware timer which is not used by any channel */
+#define GPT_NO_CHANNEL             (0xFFU)
+
+/* States of a Gpt channel */
+#define GPT_CHANNEL_INITIALIZED    (0U)
+#define GPT_CHANNEL_RUNNING        (1U)
+#define GPT_CHANNEL_STOPPED        (2U)
+#define GPT_CHANNEL_EXPIRED        (3U)
+
+/* Base address and Timer A interrupt number of each hardware timer ordered by Gpt_HwTimerType */
+STATIC const uint32 Gpt_HwBaseAddress[GPT_NUMBER_OF_HW_TIMERS] = {
+                                                                     GPT_TIMER0_BASE_ADDRESS,  GPT_TIMER1_BASE_ADDRESS,
+                                                                     GPT_TIMER2_BASE_ADDRESS,  GPT_TIMER3_BASE_ADDRESS,
+                                                                     GPT_TIMER4_BASE_ADDRESS,  GPT_TIMER5_BASE_ADDRESS,
+                                                                     GPT_WTIMER0_BASE_ADDRESS, GPT_WTIMER1_BASE_ADDRESS,
+                                                                     GPT_WTIMER2_BASE_ADDRESS, GPT_WTIMER3_BASE_ADDRESS,
+                                                                     GPT_WTIMER4_BASE_ADDRESS, GPT_WTIMER5_BASE_ADDRESS
+                                                                 };
+STATIC const Irq_NumberType Gpt_HwIrq[GPT_NUMBER_OF_HW_TIMERS] = {
+                                                            GPT_TIMER0A_IRQ,  GPT_TIMER1A_IRQ,  GPT_TIMER2A_IRQ,
+                                                            GPT_TIMER3A_IRQ,  GPT_TIMER4A_IRQ,  GPT_TIMER5A_IRQ,
+                                                            GPT_WTIMER0A_IRQ, GPT_WTIMER1A_IRQ, GPT_WTIMER2A_IRQ,
+                                                            GPT_WTIMER3A_IRQ, GPT_WTIMER4A_IRQ, GPT_WTIMER5A_IRQ
+                                                        };
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* Channel using each hardware timer, used by the timers ISRs */
+STATIC Gpt_ChannelType Gpt_HwChannel[GPT_NUMBER_OF_HW_TIMERS] = {
+                                                                    GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL,
+                                                                    GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL,
+                                                                    GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL,
+                                                                    GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL
+                                                                };
+
+/* State, target time and time elapsed when stopped of each channel */
+STATIC volatile uint8 Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_ChannelTarget[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_ChannelStopElapsed[GPT_CONFIGURED_CHANNELS];
+
+/* Notification enable of each channel */
+STATIC volatile boolean Gpt_NotificationEnabled[GPT_CONFIGURED_CHANNELS];
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/* Number of wraps of the 32-bit timestamp counter ... upper 32 bits of the timestamp */
+STATIC volatile uint32 Gpt_TimestampHigh = 0;
+#endif
+
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+/* Number of system clock cycles between two SysTick interrupts is limited by the 24-bit reload register */
+#define SYSTICK_MAX_PERIOD     0x01000000UL
+
+/* Description: Structure to hold a SysTick subscriber:
+ *  1. the upper layer function called back from the SysTick ISR
+ *  2. the number of ticks between two calls
+ *  3. the ticks remaining before the next call
+ *  4. the order of the call in the tick (0 is called first)
+ */
+typedef struct
+{
+    void (*Callback)(void);
+    uint16 Divider;
+    uint16 Count;
+    uint8 Priority;
+}SysTick_SubscriberType;
+
+/* Subscribers table sorted by priority when they are added so the ISR just walks it */
+static SysTick_SubscriberType g_SysTick_Subscribers[GPT_SYSTICK_MAX_SUBSCRIBERS];
+static uint8 g_SysTick_NumberOfSubscribers = 0;
+
+/* The subscribers table is not changed while the SysTick Timer runs */
+static boolean g_SysTick_Running = FALSE;
+
+/* Tick time in miliseconds given to SysTick_Start, used to recompute the reload after a clock change */
+static uint16 g_SysTick_TickTime = 0;
+
+/* Number of SysTick interrupts per tick (more than 1 when the tick exceeds the 24-bit range)
+ * and interrupts remaining before the next call back */
+static uint16 g_SysTick_Divider = 1;
+static volatile uint16 g_SysTick_Count = 1;
+
+/* Last and worst-case SysTick ISR time in system clock cycles */
+static volatile uint32 g_SysTick_IsrLastCycles = 0;
+static volatile uint32 g_SysTick_IsrMaxCycles = 0;
 
 /************************************************************************************
 * Service Name: SysTick_Handler
@@ -26,39 +126,108 @@ static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    /* The SysTick counter counts down from the reload value, it times the ISR without another timer */
+    uint32 start_value = SYSTICK_CURRENT_REG;
+    uint32 end_value;
+    uint32 cycles;
+    uint8 index;
+    SysTick_SubscriberType * subscriber;
+
+    /* Extend the 24-bit SysTick period, the subscribers are called once per tick */
+    g_SysTick_Count--;
+    if(0 == g_SysTick_Count)
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        g_SysTick_Count = g_SysTick_Divider;
+
+        for(index = 0; index < g_SysTick_NumberOfSubscribers; index++)
+        {
+            subscriber = &g_SysTick_Subscribers[index];
+            subscriber->Count--;
+            if(0 == subscriber->Count)
+            {
+                subscriber->Count = subscriber->Divider;
+                (*subscriber->Callback)(); /* call the function in the upper layer using call-back concept */
+            }
+        }
     }
     /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
+
+    end_value = SYSTICK_CURRENT_REG;
+    cycles = start_value - end_value;
+    if(end_value > start_value)
+    {
+        /* The counter reloaded during the ISR */
+        cycles += SYSTICK_RELOAD_REG + 1;
+    }
+    g_SysTick_IsrLastCycles = cycles;
+    if(cycles > g_SysTick_IsrMaxCycles)
+    {
+        g_SysTick_IsrMaxCycles = cycles;
+    }
 }
 
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time - Time in miliseconds (1 .. 65535)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Compute the Reload value from the system clock frequency published by Mcu,
+*                a tick longer than the 24-bit SysTick range is divided into several interrupts
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
-    /* Configure the SysTick Control Register 
-     * Enable the SysTick Timer (ENABLE = 1)
-     * Enable SysTick Interrupt (INTEN = 1)
-     * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    /* Number of system clock cycles in one tick ... 64-bit as it reaches 5.2e9 at 80 MHz */
+    uint64 tick_cycles = ((uint64)Mcu_GetSysClockFrequency() * Tick_Time) / 1000U;
+    uint16 divider;
+    uint8 index;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* A reload value of 0 disables the SysTick Timer */
+    if(tick_cycles < 2U)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_START_SID, GPT_E_PARAM_VALUE);
+        error = TRUE;
+    }
+#endif
+
+    if(FALSE == error)
+    {
+        /* Smallest number of interrupts per tick keeping each period in the 24-bit range,
+         * the period is rounded to the nearest cycle when the tick is not a multiple of it */
+        divider = (uint16)((tick_cycles + SYSTICK_MAX_PERIOD - 1) / SYSTICK_MAX_PERIOD);
+
+        SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
+        g_SysTick_TickTime  = Tick_Time;
+        g_SysTick_Divider   = divider;
+        g_SysTick_Count     = divider;
+        for(index = 0; index < g_SysTick_NumberOfSubscribers; index++)
+        {
+            g_SysTick_Subscribers[index].Count = g_SysTick_Subscribers[index].Divider;
+        }
+        g_SysTick_IsrLastCycles = 0;
+        g_SysTick_IsrMaxCycles  = 0;
+        g_SysTick_Running       = TRUE;
+        SYSTICK_RELOAD_REG  = (uint32)((tick_cycles + (divider / 2)) / divider) - 1; /* Set the Reload value to count n miliseconds */
+        SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+        /* Configure the SysTick Control Register 
+         * Enable the SysTick Timer (ENABLE = 1)
+         * Enable SysTick Interrupt (INTEN = 1)
+         * Choose the clock source to be System Clock (CLK_SRC = 1) */
+        SYSTICK_CTRL_REG   |= 0x07;
+        /* Assign priority level 3 to the SysTick Interrupt */
+        NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************
@@ -74,19 +243,784 @@ void SysTick_Start(uint16 Tick_Time)
 void SysTick_Stop(void)
 {
     SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    g_SysTick_Running = FALSE;
 }
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_Subscribe
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
+* Reentrancy: Non reentrant
 * Parameters (in): Ptr2Func - Call Back function address
+*                  Divider - The function is called every Divider ticks (1 .. 65535)
+*                  Priority - Order of the calls in the same tick (0 is called first)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is added to the subscribers table
+* Description: Function to add a call back to the SysTick ISR, it must be called before SysTick_Start.
+*              The table is kept sorted by priority (subscribers of the same priority in the
+*              order they are added) so the ISR does not search it.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(void(*Ptr2Func)(void), uint16 Divider, uint8 Priority)
+{
+    uint8 index;
+    Std_ReturnType ret = E_OK;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == Ptr2Func)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_SUBSCRIBE_SID, GPT_E_PARAM_POINTER);
+        ret = E_NOT_OK;
+    }
+    else if(0 == Divider)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_SUBSCRIBE_SID, GPT_E_PARAM_VALUE);
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    if(E_OK == ret)
+    {
+        if(TRUE == g_SysTick_Running)
+        {
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_SUBSCRIBE_SID, GPT_E_BUSY);
+#endif
+            ret = E_NOT_OK;
+        }
+        else if(GPT_SYSTICK_MAX_SUBSCRIBERS == g_SysTick_NumberOfSubscribers)
+        {
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_SUBSCRIBE_SID, GPT_E_SYSTICK_SUBSCRIBERS_FULL);
+#endif
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* Shift the lower priority subscribers to insert the new one after the same priority ones */
+            index = g_SysTick_NumberOfSubscribers;
+            while((index > 0) && (g_SysTick_Subscribers[index - 1].Priority > Priority))
+            {
+                g_SysTick_Subscribers[index] = g_SysTick_Subscribers[index - 1];
+                index--;
+            }
+            g_SysTick_Subscribers[index].Callback = Ptr2Func;
+            g_SysTick_Subscribers[index].Divider  = Divider;
+            g_SysTick_Subscribers[index].Count    = Divider;
+            g_SysTick_Subscribers[index].Priority = Priority;
+            g_SysTick_NumberOfSubscribers++;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeToNextTick
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Time in microseconds until the next call of the subscribers, 0 if stopped
+* Description: Function to return the time left in the current tick, used to decide how deep the
+*              core can sleep.
+************************************************************************************/
+uint32 SysTick_GetTimeToNextTick(void)
+{
+    uint32 cycles_per_us = Mcu_GetSysClockFrequency() / 1000000UL;
+    uint32 time = 0;
+
+    if((TRUE == g_SysTick_Running) && (cycles_per_us != 0))
+    {
+        /* Current period then the remaining periods of an extended tick, in us to stay in 32 bits */
+        time = (SYSTICK_CURRENT_REG / cycles_per_us)
+             + ((uint32)(g_SysTick_Count - 1) * ((SYSTICK_RELOAD_REG + 1) / cycles_per_us));
+    }
+    return time;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetIsrTime
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): IsrTime - Last and worst-case SysTick ISR time in system clock cycles
+* Return value: None
+* Description: Function to report the SysTick ISR execution time including all its subscribers.
+************************************************************************************/
+void SysTick_GetIsrTime(SysTick_IsrTimeType * IsrTime)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == IsrTime)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_GET_ISR_TIME_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        IsrTime->LastCycles = g_SysTick_IsrLastCycles;
+        IsrTime->MaxCycles  = g_SysTick_IsrMaxCycles;
+    }
+}
+
+/************************************************************************************
+* Description: Check the module is initialized and the channel is valid before using it
+************************************************************************************/
+STATIC boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ApiId)
+{
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	return error;
+}
+
+/************************************************************************************
+* Description: Return the base address of the hardware timer of the channel
+************************************************************************************/
+STATIC uint32 Gpt_ChannelBase(Gpt_ChannelType Channel)
+{
+	return Gpt_HwBaseAddress[Gpt_Channels[Channel].HwTimer];
+}
+
+/************************************************************************************
+* Description: Return the number of ticks elapsed since the channel was started
+*              (the timer counts down from Target - 1 to 0)
+************************************************************************************/
+STATIC Gpt_ValueType Gpt_ReadElapsed(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType elapsed;
+	uint32 base = Gpt_ChannelBase(Channel);
+
+	switch(Gpt_ChannelState[Channel])
+	{
+		case GPT_CHANNEL_RUNNING:
+			/* A one-shot time-out not served yet by the ISR has reached the target time */
+			if((GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].ChannelMode)
+			&& BIT_IS_SET(GPT_REG(base, GPT_RIS_REG_OFFSET), GPT_INT_TATO_BIT))
+			{
+				elapsed = Gpt_ChannelTarget[Channel];
+			}
+			else
+			{
+				elapsed = (Gpt_ChannelTarget[Channel] - 1) - GPT_REG(base, GPT_TAR_REG_OFFSET);
+			}
+			break;
+		case GPT_CHANNEL_STOPPED:
+			elapsed = Gpt_ChannelStopElapsed[Channel];
+			break;
+		case GPT_CHANNEL_EXPIRED:
+			elapsed = Gpt_ChannelTarget[Channel];
+			break;
+		default:
+			elapsed = 0;
+			break;
+	}
+	return elapsed;
+}
+
+/************************************************************************************
+* Description: Common part of the timers ISRs ... acknowledge the time-out, stop a one-shot
+*              channel then call the channel notification if it is enabled
+************************************************************************************/
+STATIC void Gpt_HwIsr(Gpt_HwTimerType HwTimer)
+{
+	Gpt_ChannelType channel = Gpt_HwChannel[HwTimer];
+	uint32 base = Gpt_HwBaseAddress[HwTimer];
+
+	GPT_REG(base, GPT_ICR_REG_OFFSET) = (1UL << GPT_INT_TATO_BIT);
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+	if(GPT_TIMESTAMP_HW_TIMER == HwTimer)
+	{
+		Gpt_TimestampHigh++;
+	}
+#endif
+
+	if(GPT_NO_CHANNEL != channel)
+	{
+		if(GPT_CH_MODE_ONESHOT == Gpt_Channels[channel].ChannelMode)
+		{
+			/* The hardware already disabled the one-shot timer */
+			CLEAR_BIT(GPT_REG(base, GPT_IMR_REG_OFFSET), GPT_INT_TATO_BIT);
+			Gpt_ChannelState[channel] = GPT_CHANNEL_EXPIRED;
+		}
+
+		if((TRUE == Gpt_NotificationEnabled[channel]) && (NULL_PTR != Gpt_Channels[channel].Notification))
+		{
+			(*Gpt_Channels[channel].Notification)();
+		}
+	}
+}
+
+/************************************************************************************
+* Description: Timers ISRs installed by Gpt_Init
+************************************************************************************/
+STATIC void Gpt_Timer0Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER0);
+}
+
+STATIC void Gpt_Timer1Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER1);
+}
+
+STATIC void Gpt_Timer2Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER2);
+}
+
+STATIC void Gpt_Timer3Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER3);
+}
+
+STATIC void Gpt_Timer4Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER4);
+}
+
+STATIC void Gpt_Timer5Isr(void)
+{
+	Gpt_HwIsr(GPT_TIMER5);
+}
+
+STATIC void Gpt_WTimer0Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER0);
+}
+
+STATIC void Gpt_WTimer1Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER1);
+}
+
+STATIC void Gpt_WTimer2Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER2);
+}
+
+STATIC void Gpt_WTimer3Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER3);
+}
+
+STATIC void Gpt_WTimer4Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER4);
+}
+
+STATIC void Gpt_WTimer5Isr(void)
+{
+	Gpt_HwIsr(GPT_WTIMER5);
+}
+
+/* ISR of each hardware timer ordered by Gpt_HwTimerType */
+STATIC const Irq_HandlerType Gpt_HwHandlers[GPT_NUMBER_OF_HW_TIMERS] = {
+                                                                          Gpt_Timer0Isr,  Gpt_Timer1Isr,  Gpt_Timer2Isr,
+                                                                          Gpt_Timer3Isr,  Gpt_Timer4Isr,  Gpt_Timer5Isr,
+                                                                          Gpt_WTimer0Isr, Gpt_WTimer1Isr, Gpt_WTimer2Isr,
+                                                                          Gpt_WTimer3Isr, Gpt_WTimer4Isr, Gpt_WTimer5Isr
+                                                                      };
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Description: Start the timestamp timer, its 32-bit Timer A counts down from 0xFFFFFFFF every
+*              microsecond and wraps every 71.6 minutes, the wraps are counted by its ISR,
+*              the prescaler divides the current system clock down to GPT_TIMESTAMP_FREQUENCY_HZ
+************************************************************************************/
+STATIC void Gpt_StartTimestamp(void)
+{
+	uint32 base = Gpt_HwBaseAddress[GPT_TIMESTAMP_HW_TIMER];
+	uint32 clock_mask = (1UL << (GPT_TIMESTAMP_HW_TIMER - GPT_WTIMER0));
+
+	SYSCTL_RCGCWTIMER_REG |= clock_mask;
+	while(!(SYSCTL_PRWTIMER_REG & clock_mask));
+
+	GPT_REG(base, GPT_CTL_REG_OFFSET)   = 0;
+	GPT_REG(base, GPT_CFG_REG_OFFSET)   = GPT_CFG_32_BIT_INDIVIDUAL;
+	/* Count down, the prescaler acts as a timer extension instead of a prescaler when counting up */
+	GPT_REG(base, GPT_TAMR_REG_OFFSET)  = GPT_TAMR_PERIODIC;
+	GPT_REG(base, GPT_TAPR_REG_OFFSET)  = (Mcu_GetSysClockFrequency() / GPT_TIMESTAMP_FREQUENCY_HZ) - 1;
+	GPT_REG(base, GPT_TAILR_REG_OFFSET) = 0xFFFFFFFFUL;
+	GPT_REG(base, GPT_ICR_REG_OFFSET)   = (1UL << GPT_INT_TATO_BIT);
+	GPT_REG(base, GPT_IMR_REG_OFFSET)   = (1UL << GPT_INT_TATO_BIT);
+
+	Gpt_TimestampHigh = 0;
+
+	Irq_Register(Gpt_HwIrq[GPT_TIMESTAMP_HW_TIMER], Gpt_HwHandlers[GPT_TIMESTAMP_HW_TIMER], GPT_INTERRUPT_PRIORITY);
+	Irq_EnableInterrupt(Gpt_HwIrq[GPT_TIMESTAMP_HW_TIMER]);
+
+	/* The timestamp keeps counting while the debugger halts the CPU to stay aligned with the real time */
+	GPT_REG(base, GPT_CTL_REG_OFFSET)   = (1UL << GPT_CTL_TAEN_BIT);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module:
+*              - Enable the clock of the hardware timer of each channel
+*              - Configure it as a 32-bit one-shot or periodic timer counting down
+*              - Install the timer ISR with Irq_Register and enable its interrupt
+*              The channels are stopped and their notifications are disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+	Gpt_ChannelType channel;
+	Gpt_HwTimerType hw_timer;
+	uint32 base;
+	uint32 clock_mask;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+		     GPT_E_PARAM_CONFIG);
+		error = TRUE;
+	}
+	else if (GPT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+		     GPT_E_ALREADY_INITIALIZED);
+		error = TRUE;
+	}
+	else
+	{
+		/* The concatenated 32-bit mode of the 16/32-bit timers has no prescaler
+		 * and the timestamp timer is reserved */
+		for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+		{
+			if(((ConfigPtr->Channels[channel].HwTimer < GPT_WTIMER0) && (0 != ConfigPtr->Channels[channel].Prescale))
+#if (GPT_TIMESTAMP_API == STD_ON)
+			|| (GPT_TIMESTAMP_HW_TIMER == ConfigPtr->Channels[channel].HwTimer)
+#endif
+			)
+			{
+				Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+				     GPT_E_PARAM_CONFIG);
+				error = TRUE;
+			}
+		}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+		/* The timestamp prescaler (16-bit) needs a whole number of system clock cycles per microsecond */
+		if(((Mcu_GetSysClockFrequency() % GPT_TIMESTAMP_FREQUENCY_HZ) != 0)
+		|| ((Mcu_GetSysClockFrequency() / GPT_TIMESTAMP_FREQUENCY_HZ) > 0x10000UL))
+		{
+			Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+			     GPT_E_PARAM_CONFIG);
+			error = TRUE;
+		}
+#endif
+	}
+#endif
+
+	if(FALSE == error)
+	{
+		Gpt_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+		{
+			hw_timer = Gpt_Channels[channel].HwTimer;
+			base     = Gpt_HwBaseAddress[hw_timer];
+
+			/* Enable the clock of the timer and wait until it is ready */
+			if(hw_timer < GPT_WTIMER0)
+			{
+				clock_mask = (1UL << hw_timer);
+				SYSCTL_RCGCTIMER_REG |= clock_mask;
+				while(!(SYSCTL_PRTIMER_REG & clock_mask));
+			}
+			else
+			{
+				clock_mask = (1UL << (hw_timer - GPT_WTIMER0));
+				SYSCTL_RCGCWTIMER_REG |= clock_mask;
+				while(!(SYSCTL_PRWTIMER_REG & clock_mask));
+			}
+
+			GPT_REG(base, GPT_CTL_REG_OFFSET) = 0;              /* Disable the timer during its configuration */
+			if(hw_timer < GPT_WTIMER0)
+			{
+				GPT_REG(base, GPT_CFG_REG_OFFSET) = GPT_CFG_32_BIT_TIMER;
+			}
+			else
+			{
+				GPT_REG(base, GPT_CFG_REG_OFFSET)  = GPT_CFG_32_BIT_INDIVIDUAL;
+				GPT_REG(base, GPT_TAPR_REG_OFFSET) = Gpt_Channels[channel].Prescale;
+			}
+
+			/* Count down (TACDIR = 0) in one-shot or periodic mode */
+			if(GPT_CH_MODE_ONESHOT == Gpt_Channels[channel].ChannelMode)
+			{
+				GPT_REG(base, GPT_TAMR_REG_OFFSET) = GPT_TAMR_ONE_SHOT;
+			}
+			else
+			{
+				GPT_REG(base, GPT_TAMR_REG_OFFSET) = GPT_TAMR_PERIODIC;
+			}
+
+			GPT_REG(base, GPT_IMR_REG_OFFSET) = 0;
+			GPT_REG(base, GPT_ICR_REG_OFFSET) = (1UL << GPT_INT_TATO_BIT);
+
+			Gpt_HwChannel[hw_timer]           = channel;
+			Gpt_ChannelState[channel]         = GPT_CHANNEL_INITIALIZED;
+			Gpt_NotificationEnabled[channel]  = FALSE;
+
+			Irq_Register(Gpt_HwIrq[hw_timer], Gpt_HwHandlers[hw_timer], GPT_INTERRUPT_PRIORITY);
+			Irq_EnableInterrupt(Gpt_HwIrq[hw_timer]);
+		}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+		Gpt_StartTimestamp();
+#endif
+
+		Gpt_Status = GPT_INITIALIZED;
+	}
+}
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Elapsed timer ticks
+* Description: Function to return the time elapsed since the channel was started (or the last
+*              period of a continuous channel), the target time for an expired one-shot channel.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType elapsed = 0;
+
+	if(FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID))
+	{
+		elapsed = Gpt_ReadElapsed(Channel);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return elapsed;
+}
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Remaining timer ticks
+* Description: Function to return the time remaining until the next expiry of the channel,
+*              0 for an expired one-shot channel or a channel which was never started.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType remaining = 0;
+
+	if(FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID))
+	{
+		if(GPT_CHANNEL_INITIALIZED != Gpt_ChannelState[Channel])
+		{
+			remaining = Gpt_ChannelTarget[Channel] - Gpt_ReadElapsed(Channel);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value - Target time in number of ticks
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the channel, it expires after Value ticks (then every
+*              Value ticks for a continuous channel).
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+	uint32 base;
+	boolean error = Gpt_CheckChannel(Channel, GPT_START_TIMER_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if ((FALSE == error) && (0 == Value))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID,
+				GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+		error = TRUE;
+	}
+	else if ((FALSE == error) && (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID,
+				GPT_START_TIMER_SID, GPT_E_BUSY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		base = Gpt_ChannelBase(Channel);
+
+		Gpt_ChannelTarget[Channel] = Value;
+		Gpt_ChannelState[Channel]  = GPT_CHANNEL_RUNNING;
+
+		GPT_REG(base, GPT_TAILR_REG_OFFSET) = Value - 1;
+		GPT_REG(base, GPT_ICR_REG_OFFSET)   = (1UL << GPT_INT_TATO_BIT);
+
+		/* The interrupt of a one-shot channel is always needed to update the channel state */
+		if((GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].ChannelMode) || (TRUE == Gpt_NotificationEnabled[Channel]))
+		{
+			SET_BIT(GPT_REG(base, GPT_IMR_REG_OFFSET), GPT_INT_TATO_BIT);
+		}
+
+		/* Enable the timer ... it stalls while the debugger halts the CPU */
+		GPT_REG(base, GPT_CTL_REG_OFFSET) = (1UL << GPT_CTL_TAEN_BIT) | (1UL << GPT_CTL_TASTALL_BIT);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a running channel, the elapsed time is kept for Gpt_GetTimeElapsed.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+	uint32 base;
+
+	if((FALSE == Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID)) && (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]))
+	{
+		base = Gpt_ChannelBase(Channel);
+
+		Gpt_ChannelStopElapsed[Channel] = Gpt_ReadElapsed(Channel);
+		GPT_REG(base, GPT_CTL_REG_OFFSET) = 0;
+		CLEAR_BIT(GPT_REG(base, GPT_IMR_REG_OFFSET), GPT_INT_TATO_BIT);
+		GPT_REG(base, GPT_ICR_REG_OFFSET) = (1UL << GPT_INT_TATO_BIT);
+		Gpt_ChannelState[Channel] = GPT_CHANNEL_STOPPED;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimestamp
+* Service ID[hex]: 0x0D
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_TimestampType - Microseconds since Gpt_Init
+* Description: Function to read the monotonic 64-bit microsecond timestamp without a critical section:
+*              - The wrap counter is read before and after the timer, the read is repeated if the
+*                timestamp ISR counted a wrap in between
+*              - A wrap not counted yet by the ISR (read with the interrupts disabled or from a higher
+*                priority interrupt) is detected by the raw time-out flag set with a small count
+************************************************************************************/
+Gpt_TimestampType Gpt_GetTimestamp(void)
+{
+	uint32 base = Gpt_HwBaseAddress[GPT_TIMESTAMP_HW_TIMER];
+	uint32 wraps;
+	uint32 high;
+	uint32 low;
+	Gpt_TimestampType timestamp = 0;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* The timer registers can not be read before its clock is enabled by Gpt_Init */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIMESTAMP_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+#endif
+
+	if(FALSE == error)
+	{
+		do
+		{
+			wraps = Gpt_TimestampHigh;
+			high  = wraps;
+			low   = ~GPT_REG(base, GPT_TAR_REG_OFFSET);   /* The timer counts down from 0xFFFFFFFF */
+			if(BIT_IS_SET(GPT_REG(base, GPT_RIS_REG_OFFSET), GPT_INT_TATO_BIT) && (low < 0x80000000UL))
+			{
+				high++;
+			}
+		}while(wraps != Gpt_TimestampHigh);
+
+		timestamp = (((Gpt_TimestampType)high << 32) | low);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return timestamp;
+}
+#endif
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of the channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+	if(FALSE == Gpt_CheckChannel(Channel, GPT_ENABLE_NOTIFICATION_SID))
+	{
+		Gpt_NotificationEnabled[Channel] = TRUE;
+		if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+		{
+			SET_BIT(GPT_REG(Gpt_ChannelBase(Channel), GPT_IMR_REG_OFFSET), GPT_INT_TATO_BIT);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of the channel, a continuous channel
+*              then runs without interrupts.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+	if(FALSE == Gpt_CheckChannel(Channel, GPT_DISABLE_NOTIFICATION_SID))
+	{
+		Gpt_NotificationEnabled[Channel] = FALSE;
+		if(GPT_CH_MODE_CONTINUOUS == Gpt_Channels[Channel].ChannelMode)
+		{
+			CLEAR_BIT(GPT_REG(Gpt_ChannelBase(Channel), GPT_IMR_REG_OFFSET), GPT_INT_TATO_BIT);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_ClockNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function called by Mcu after each change of the system clock frequency:
+*              - Restart a running SysTick Timer with the reload of the new frequency
+*              - Reload the timestamp prescaler keeping the count (a few cycles are lost)
+*              The Gpt channels count system clock ticks, their users restart them if needed.
 ************************************************************************************/
-void SysTick_SetCallBack(void(*Ptr2Func)(void))
+void Gpt_ClockNotification(void)
 {
-    g_SysTick_Call_Back_Ptr = Ptr2Func;
+#if (GPT_TIMESTAMP_API == STD_ON)
+	uint32 base = Gpt_HwBaseAddress[GPT_TIMESTAMP_HW_TIMER];
+	uint32 value;
+#endif
+
+	if(TRUE == g_SysTick_Running)
+	{
+		SysTick_Start(g_SysTick_TickTime);
+	}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+	if(GPT_INITIALIZED == Gpt_Status)
+	{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+		if(((Mcu_GetSysClockFrequency() % GPT_TIMESTAMP_FREQUENCY_HZ) != 0)
+		|| ((Mcu_GetSysClockFrequency() / GPT_TIMESTAMP_FREQUENCY_HZ) > 0x10000UL))
+		{
+			Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+		}
+#endif
+		CLEAR_BIT(GPT_REG(base, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_BIT);
+		value = GPT_REG(base, GPT_TAR_REG_OFFSET);
+		GPT_REG(base, GPT_TAPR_REG_OFFSET) = (Mcu_GetSysClockFrequency() / GPT_TIMESTAMP_FREQUENCY_HZ) - 1;
+		GPT_REG(base, GPT_TAV_REG_OFFSET)  = value;
+		SET_BIT(GPT_REG(base, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_BIT);
+	}
+#endif
 }
@@ -4,7 +4,8 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver over the 16/32-bit
+ *              and 32/64-bit General-Purpose Timers and the SysTick Timer used by the Os.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
@@ -12,23 +13,240 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for GPT GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID             (uint8)0x00
+
+/* Service ID for GPT Init */
+#define GPT_INIT_SID                         (uint8)0x01
+
+/* Service ID for GPT Get Time Elapsed */
+#define GPT_GET_TIME_ELAPSED_SID             (uint8)0x03
+
+/* Service ID for GPT Get Time Remaining */
+#define GPT_GET_TIME_REMAINING_SID           (uint8)0x04
+
+/* Service ID for GPT Start Timer */
+#define GPT_START_TIMER_SID                  (uint8)0x05
+
+/* Service ID for GPT Stop Timer */
+#define GPT_STOP_TIMER_SID                   (uint8)0x06
+
+/* Service ID for GPT Enable Notification */
+#define GPT_ENABLE_NOTIFICATION_SID          (uint8)0x07
+
+/* Service ID for GPT Disable Notification */
+#define GPT_DISABLE_NOTIFICATION_SID         (uint8)0x08
+
+/* Service ID for GPT Get Timestamp (id of the AUTOSAR Gpt_GetPredefTimerValue service) */
+#define GPT_GET_TIMESTAMP_SID                (uint8)0x0D
+
+/* Service ID for SysTick Start used by the Os tick */
+#define GPT_SYSTICK_START_SID                (uint8)0x80
+
+/* Service ID for SysTick Subscribe */
+#define GPT_SYSTICK_SUBSCRIBE_SID            (uint8)0x81
+
+/* Service ID for SysTick Get Isr Time */
+#define GPT_SYSTICK_GET_ISR_TIME_SID         (uint8)0x82
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service used without module initialization */
+#define GPT_E_UNINIT                         (uint8)0x0A
+
+/* Gpt_StartTimer called while the channel is running */
+#define GPT_E_BUSY                           (uint8)0x0B
+
+/* Gpt_Init API service called while the module is already initialized */
+#define GPT_E_ALREADY_INITIALIZED            (uint8)0x0D
+
+/* DET code to report Invalid Channel */
+#define GPT_E_PARAM_CHANNEL                  (uint8)0x14
+
+/* DET code to report an Invalid timeout value */
+#define GPT_E_PARAM_VALUE                    (uint8)0x15
+
+/* API service called with NULL pointer parameter */
+#define GPT_E_PARAM_POINTER                  (uint8)0x16
+
+/* SysTick_Subscribe called with all the GPT_SYSTICK_MAX_SUBSCRIBERS entries used */
+#define GPT_E_SYSTICK_SUBSCRIBERS_FULL       (uint8)0x80
+
+/* Gpt_Init API service called with an invalid channel configuration (prescaler on a 16/32-bit timer
+ * or a channel using the timestamp timer) or a system clock the timestamp can not be derived from */
+#define GPT_E_PARAM_CONFIG                   (uint8)0x0E
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the GPT APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType used by the GPT APIs (timer ticks) */
+typedef uint32 Gpt_ValueType;
+
+/* Type definition for the timestamp in microseconds since Gpt_Init (it does not wrap in the device life time) */
+typedef uint64 Gpt_TimestampType;
+
+/* Type definition for Gpt_ChannelModeType */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS, GPT_CH_MODE_ONESHOT
+}Gpt_ChannelModeType;
+
+/* Type definition for the hardware timer used by a channel (its Timer A or the concatenated 32-bit timer) */
+typedef enum
+{
+    GPT_TIMER0, GPT_TIMER1, GPT_TIMER2, GPT_TIMER3, GPT_TIMER4, GPT_TIMER5,
+    GPT_WTIMER0, GPT_WTIMER1, GPT_WTIMER2, GPT_WTIMER3, GPT_WTIMER4, GPT_WTIMER5
+}Gpt_HwTimerType;
+
+/* Type definition for the notification called from the timer interrupt when the channel expires */
+typedef void (*Gpt_NotifyFunctionType)(void);
+
+typedef struct
+{
+	/* Member contains the hardware timer of the channel ... a 16/32-bit timer is used as a 32-bit timer
+	 * counting the system clock, a 32/64-bit wide timer is used as its 32-bit Timer A with a prescaler */
+	Gpt_HwTimerType HwTimer;
+	/* Member contains the channel mode (one-shot or continuous) */
+	Gpt_ChannelModeType ChannelMode;
+	/* Member contains the prescaler of a wide timer, the tick is the system clock divided by (Prescale + 1) */
+	uint16 Prescale;
+	/* Member contains the notification function (NULL_PTR if not used) */
+	Gpt_NotifyFunctionType Notification;
+}Gpt_ConfigChannel;
+
+/* Description: Structure to hold the execution time of the SysTick ISR in system clock cycles, measured
+ *              with the SysTick counter itself (it includes the higher priority interrupts preempting it):
+ *  1. LastCycles --> time of the last ISR
+ *  2. MaxCycles  --> worst-case time since SysTick_Start
+ */
+typedef struct
+{
+    uint32 LastCycles;
+    uint32 MaxCycles;
+}SysTick_IsrTimeType;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+	Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
+/* Function for GPT Initialization API */
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/* Function for GPT Get Time Elapsed API */
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/* Function for GPT Get Time Remaining API */
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/* Function for GPT Start Timer API */
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/* Function for GPT Stop Timer API */
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/* Function to read the free-running microsecond timestamp, usable from the tasks and the interrupts */
+Gpt_TimestampType Gpt_GetTimestamp(void);
+#endif
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/* Function for GPT Enable Notification API */
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/* Function for GPT Disable Notification API */
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time - Time in miliseconds (1 .. 65535)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Compute the Reload value from the system clock frequency published by Mcu,
+*                a tick longer than the 24-bit SysTick range is divided into several interrupts
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/	
 void SysTick_Start(uint16 Tick_Time);
@@ -46,15 +264,62 @@ void SysTick_Start(uint16 Tick_Time);
 void SysTick_Stop(void);
 
 /************************************************************************************
-* Service Name: SysTick_SetCallBack
+* Service Name: SysTick_Subscribe
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
+* Reentrancy: Non reentrant
 * Parameters (in): Ptr2Func - Call Back function address
+*                  Divider - The function is called every Divider ticks (1 .. 65535)
+*                  Priority - Order of the calls in the same tick (0 is called first)
 * Parameters (inout): None
 * Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the function is added to the subscribers table
+* Description: Function to add a call back to the SysTick ISR, it must be called before SysTick_Start.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 Divider, uint8 Priority);
+
+/************************************************************************************
+* Service Name: SysTick_GetIsrTime
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): IsrTime - Last and worst-case SysTick ISR time in system clock cycles
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to report the SysTick ISR execution time including all its subscribers.
 ************************************************************************************/
-void SysTick_SetCallBack(void (*Ptr2Func)(void));
+void SysTick_GetIsrTime(SysTick_IsrTimeType * IsrTime);
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeToNextTick
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Time in microseconds until the next call of the subscribers, 0 if stopped
+* Description: Function to return the time left in the current tick, used to decide how deep the
+*              core can sleep.
+************************************************************************************/
+uint32 SysTick_GetTimeToNextTick(void);
+
+/************************************************************************************
+* Service Name: Gpt_ClockNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by Mcu after each change of the system clock frequency to
+*              recompute the SysTick reload and the timestamp prescaler.
+************************************************************************************/
+void Gpt_ClockNotification(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
 
 #endif /* GPT_H */
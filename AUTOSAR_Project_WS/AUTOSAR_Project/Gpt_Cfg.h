@@ -0,0 +1,68 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/* Pre-compile option for the free-running microsecond timestamp (Gpt_GetTimestamp API) */
+#define GPT_TIMESTAMP_API                   (STD_ON)
+
+/* Wide timer reserved for the timestamp, it can not be used by a Gpt channel */
+#define GPT_TIMESTAMP_HW_TIMER              (GPT_WTIMER5)
+
+/* Counting frequency of the timestamp timer (1 MHz --> microseconds), its prescaler is computed from the
+ * system clock frequency published by Mcu which must be a multiple of it */
+#define GPT_TIMESTAMP_FREQUENCY_HZ          (1000000UL)
+
+/* Number of functions which can subscribe to the SysTick tick (Os tick, software PWM, watchdog ...) */
+#define GPT_SYSTICK_MAX_SUBSCRIBERS         (4U)
+
+/* Priority of the Timers interrupts (0 highest .. 7 lowest), above the GPIO and SysTick interrupts */
+#define GPT_INTERRUPT_PRIORITY              (1U)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (3U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_TIMER0_CHANNEL_ID_INDEX     (uint8)0x00
+#define GptConf_BUTTON_DEBOUNCE_CHANNEL_ID_INDEX  (uint8)0x01
+#define GptConf_SWPWM_CHANNEL_ID_INDEX      (uint8)0x02
+
+#endif /* GPT_CFG_H */
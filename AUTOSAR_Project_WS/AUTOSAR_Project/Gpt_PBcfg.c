@@ -0,0 +1,53 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Button.h"
+#include "SwPwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_PBCFG_SW_MAJOR_VERSION              (1U)
+#define GPT_PBCFG_SW_MINOR_VERSION              (0U)
+#define GPT_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_PBCFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Gpt_Init API --> Hardware timer, Mode, Prescale, Notification */
+const Gpt_ConfigType Gpt_Configuration = {
+                                             GPT_TIMER0,GPT_CH_MODE_ONESHOT,0,NULL_PTR,   /* One tick per system clock cycle (12.5ns at 80 MHz) for the fine grained timing */
+#if (BUTTON_INTERRUPT_MODE == STD_ON)
+                                             GPT_TIMER1,GPT_CH_MODE_ONESHOT,0,Button_DebounceNotification,   /* Button debounce time */
+#else
+                                             GPT_TIMER1,GPT_CH_MODE_ONESHOT,0,NULL_PTR,
+#endif
+                                             GPT_TIMER2,GPT_CH_MODE_ONESHOT,0,SwPwm_TimerNotification   /* SwPwm edges */
+                                         };
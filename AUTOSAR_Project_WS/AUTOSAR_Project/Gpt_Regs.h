@@ -0,0 +1,86 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H
+#define GPT_REGS_H
+
+#include "Std_Types.h"
+
+/* 16/32-bit Timers base addresses */
+#define GPT_TIMER0_BASE_ADDRESS           0x40030000
+#define GPT_TIMER1_BASE_ADDRESS           0x40031000
+#define GPT_TIMER2_BASE_ADDRESS           0x40032000
+#define GPT_TIMER3_BASE_ADDRESS           0x40033000
+#define GPT_TIMER4_BASE_ADDRESS           0x40034000
+#define GPT_TIMER5_BASE_ADDRESS           0x40035000
+
+/* 32/64-bit Wide Timers base addresses */
+#define GPT_WTIMER0_BASE_ADDRESS          0x40036000
+#define GPT_WTIMER1_BASE_ADDRESS          0x40037000
+#define GPT_WTIMER2_BASE_ADDRESS          0x4004C000
+#define GPT_WTIMER3_BASE_ADDRESS          0x4004D000
+#define GPT_WTIMER4_BASE_ADDRESS          0x4004E000
+#define GPT_WTIMER5_BASE_ADDRESS          0x4004F000
+
+/* Timer Registers offset addresses */
+#define GPT_CFG_REG_OFFSET                0x000     /* Configuration */
+#define GPT_TAMR_REG_OFFSET               0x004     /* Timer A Mode */
+#define GPT_TBMR_REG_OFFSET               0x008     /* Timer B Mode */
+#define GPT_CTL_REG_OFFSET                0x00C     /* Control */
+#define GPT_IMR_REG_OFFSET                0x018     /* Interrupt Mask */
+#define GPT_RIS_REG_OFFSET                0x01C     /* Raw Interrupt Status */
+#define GPT_MIS_REG_OFFSET                0x020     /* Masked Interrupt Status */
+#define GPT_ICR_REG_OFFSET                0x024     /* Interrupt Clear */
+#define GPT_TAILR_REG_OFFSET              0x028     /* Timer A Interval Load */
+#define GPT_TBILR_REG_OFFSET              0x02C     /* Timer B Interval Load */
+#define GPT_TAPR_REG_OFFSET               0x038     /* Timer A Prescale */
+#define GPT_TBPR_REG_OFFSET               0x03C     /* Timer B Prescale */
+#define GPT_TAR_REG_OFFSET                0x048     /* Timer A */
+#define GPT_TBR_REG_OFFSET                0x04C     /* Timer B */
+#define GPT_TAV_REG_OFFSET                0x050     /* Timer A Value */
+#define GPT_TBV_REG_OFFSET                0x054     /* Timer B Value */
+
+/* Access a timer register of the timer at the given base address */
+#define GPT_REG(BASE,OFFSET)              (*((volatile uint32 *)((BASE) + (OFFSET))))
+
+/* GPTMCFG values */
+#define GPT_CFG_32_BIT_TIMER              0x0       /* 16/32-bit timer: concatenated 32-bit timer */
+#define GPT_CFG_32_BIT_INDIVIDUAL         0x4       /* 32/64-bit wide timer: individual 32-bit timers A and B */
+
+/* GPTMTAMR bits */
+#define GPT_TAMR_ONE_SHOT                 0x1
+#define GPT_TAMR_PERIODIC                 0x2
+#define GPT_TAMR_TACDIR_BIT               4         /* 1 = count up */
+
+/* GPTMCTL bits */
+#define GPT_CTL_TAEN_BIT                  0         /* Timer A enable */
+#define GPT_CTL_TASTALL_BIT               1         /* Timer A stalls while the CPU is halted by the debugger */
+#define GPT_CTL_TBEN_BIT                  8         /* Timer B enable */
+
+/* GPTMIMR/RIS/MIS/ICR bits */
+#define GPT_INT_TATO_BIT                  0         /* Timer A time-out */
+#define GPT_INT_TBTO_BIT                  8         /* Timer B time-out */
+
+/* Timer A interrupt numbers */
+#define GPT_TIMER0A_IRQ                   19
+#define GPT_TIMER1A_IRQ                   21
+#define GPT_TIMER2A_IRQ                   23
+#define GPT_TIMER3A_IRQ                   35
+#define GPT_TIMER4A_IRQ                   70
+#define GPT_TIMER5A_IRQ                   92
+#define GPT_WTIMER0A_IRQ                  94
+#define GPT_WTIMER1A_IRQ                  96
+#define GPT_WTIMER2A_IRQ                  98
+#define GPT_WTIMER3A_IRQ                  100
+#define GPT_WTIMER4A_IRQ                  102
+#define GPT_WTIMER5A_IRQ                  104
+
+#endif /* GPT_REGS_H */
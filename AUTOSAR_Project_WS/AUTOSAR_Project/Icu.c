@@ -0,0 +1,357 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Icu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Icu.h"
+#include "Icu_Regs.h"
+#include "Irq.h"
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Icu Modules */
+#if ((DET_AR_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Number of the GPIO Ports */
+#define ICU_NUMBER_OF_PORTS    (6U)
+
+/* Base address and interrupt number of each GPIO Port ordered by Port Id */
+STATIC const uint32 Icu_PortBaseAddress[ICU_NUMBER_OF_PORTS] = {
+                                                                   ICU_GPIO_PORTA_BASE_ADDRESS, ICU_GPIO_PORTB_BASE_ADDRESS,
+                                                                   ICU_GPIO_PORTC_BASE_ADDRESS, ICU_GPIO_PORTD_BASE_ADDRESS,
+                                                                   ICU_GPIO_PORTE_BASE_ADDRESS, ICU_GPIO_PORTF_BASE_ADDRESS
+                                                               };
+STATIC const Irq_NumberType Icu_PortIrq[ICU_NUMBER_OF_PORTS] = {
+                                                          ICU_GPIO_PORTA_IRQ, ICU_GPIO_PORTB_IRQ, ICU_GPIO_PORTC_IRQ,
+                                                          ICU_GPIO_PORTD_IRQ, ICU_GPIO_PORTE_IRQ, ICU_GPIO_PORTF_IRQ
+                                                      };
+
+STATIC const Icu_ConfigChannel * Icu_Channels = NULL_PTR;
+STATIC uint8 Icu_Status = ICU_NOT_INITIALIZED;
+
+/* Edge detected flag of each channel, set by the GPIO Port interrupt and cleared by Icu_GetInputState */
+STATIC volatile uint8 Icu_InputActive[ICU_CONFIGURED_CHANNELS];
+
+/************************************************************************************
+* Description: Check the module is initialized and the channel is valid before using it
+************************************************************************************/
+STATIC boolean Icu_CheckChannel(Icu_ChannelType Channel, uint8 ApiId)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ApiId, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ApiId, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	return error;
+}
+
+/************************************************************************************
+* Description: Configure the edge detected by the channel pin, the pin interrupt is masked by the caller
+************************************************************************************/
+STATIC void Icu_ConfigureEdge(const Icu_ConfigChannel * ChannelPtr, Icu_ActivationType Activation)
+{
+	uint32 base = Icu_PortBaseAddress[ChannelPtr->Port_Num];
+
+	/* Edge sensitive pin */
+	CLEAR_BIT(ICU_GPIO_REG(base, ICU_GPIO_IS_REG_OFFSET), ChannelPtr->Ch_Num);
+
+	if(ICU_BOTH_EDGES == Activation)
+	{
+		SET_BIT(ICU_GPIO_REG(base, ICU_GPIO_IBE_REG_OFFSET), ChannelPtr->Ch_Num);
+	}
+	else
+	{
+		CLEAR_BIT(ICU_GPIO_REG(base, ICU_GPIO_IBE_REG_OFFSET), ChannelPtr->Ch_Num);
+		if(ICU_RISING_EDGE == Activation)
+		{
+			SET_BIT(ICU_GPIO_REG(base, ICU_GPIO_IEV_REG_OFFSET), ChannelPtr->Ch_Num);
+		}
+		else
+		{
+			CLEAR_BIT(ICU_GPIO_REG(base, ICU_GPIO_IEV_REG_OFFSET), ChannelPtr->Ch_Num);
+		}
+	}
+
+	/* Discard the edges detected with the old configuration */
+	ICU_GPIO_REG(base, ICU_GPIO_ICR_REG_OFFSET) = (1UL << ChannelPtr->Ch_Num);
+}
+
+/************************************************************************************
+* Description: Common part of the GPIO Ports ISRs ... acknowledge the detected edges
+*              then call the notification of each channel of the port with an edge
+************************************************************************************/
+STATIC void Icu_PortIsr(uint8 PortId)
+{
+	uint32 base   = Icu_PortBaseAddress[PortId];
+	uint32 status = ICU_GPIO_REG(base, ICU_GPIO_MIS_REG_OFFSET);
+	Icu_ChannelType channel;
+
+	ICU_GPIO_REG(base, ICU_GPIO_ICR_REG_OFFSET) = status;
+
+	for(channel = 0; channel < ICU_CONFIGURED_CHANNELS; channel++)
+	{
+		if((Icu_Channels[channel].Port_Num == PortId) && BIT_IS_SET(status, Icu_Channels[channel].Ch_Num))
+		{
+			Icu_InputActive[channel] = TRUE;
+			if(Icu_Channels[channel].Notification != NULL_PTR)
+			{
+				(*Icu_Channels[channel].Notification)();
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Description: GPIO Ports ISRs installed by Icu_Init
+************************************************************************************/
+STATIC void Icu_PortAIsr(void)
+{
+	Icu_PortIsr(0);
+}
+
+STATIC void Icu_PortBIsr(void)
+{
+	Icu_PortIsr(1);
+}
+
+STATIC void Icu_PortCIsr(void)
+{
+	Icu_PortIsr(2);
+}
+
+STATIC void Icu_PortDIsr(void)
+{
+	Icu_PortIsr(3);
+}
+
+STATIC void Icu_PortEIsr(void)
+{
+	Icu_PortIsr(4);
+}
+
+STATIC void Icu_PortFIsr(void)
+{
+	Icu_PortIsr(5);
+}
+
+/* ISR of each GPIO Port ordered by Port Id */
+STATIC const Irq_HandlerType Icu_PortHandlers[ICU_NUMBER_OF_PORTS] = {
+                                                                         Icu_PortAIsr, Icu_PortBIsr, Icu_PortCIsr,
+                                                                         Icu_PortDIsr, Icu_PortEIsr, Icu_PortFIsr
+                                                                     };
+
+/************************************************************************************
+* Service Name: Icu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Icu module:
+*              - Configure the default start edge of each channel with its notification disabled
+*              - Set the priority and enable the interrupt of the GPIO Ports used by the channels
+*              The channel pins are configured as digital inputs by the Port Driver.
+************************************************************************************/
+void Icu_Init(const Icu_ConfigType * ConfigPtr)
+{
+	Icu_ChannelType channel;
+	uint8 port;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID,
+		     ICU_E_PARAM_CONFIG);
+	}
+	else if (ICU_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID,
+		     ICU_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		Icu_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		for(channel = 0; channel < ICU_CONFIGURED_CHANNELS; channel++)
+		{
+			port = Icu_Channels[channel].Port_Num;
+			CLEAR_BIT(ICU_GPIO_REG(Icu_PortBaseAddress[port], ICU_GPIO_IM_REG_OFFSET), Icu_Channels[channel].Ch_Num);
+			Icu_ConfigureEdge(&Icu_Channels[channel], Icu_Channels[channel].DefaultStartEdge);
+			Icu_InputActive[channel] = FALSE;
+
+			Irq_Register(Icu_PortIrq[port], Icu_PortHandlers[port], ICU_INTERRUPT_PRIORITY);
+			Irq_EnableInterrupt(Icu_PortIrq[port]);
+		}
+
+		Icu_Status = ICU_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+* Service Name: Icu_SetActivationCondition
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+*                  Activation - Type of activation (rising, falling or both edges)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the edge detected by a channel.
+************************************************************************************/
+void Icu_SetActivationCondition(Icu_ChannelType Channel, Icu_ActivationType Activation)
+{
+	uint32 base;
+	boolean masked;
+	boolean error = Icu_CheckChannel(Channel, ICU_SET_ACTIVATION_CONDITION_SID);
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if ((FALSE == error) && (ICU_BOTH_EDGES < Activation))
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID,
+				ICU_SET_ACTIVATION_CONDITION_SID, ICU_E_PARAM_ACTIVATION);
+		error = TRUE;
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Changing IS/IBE/IEV may detect a false edge ... mask the pin interrupt during the change */
+		base   = Icu_PortBaseAddress[Icu_Channels[Channel].Port_Num];
+		masked = BIT_IS_CLEAR(ICU_GPIO_REG(base, ICU_GPIO_IM_REG_OFFSET), Icu_Channels[Channel].Ch_Num);
+		CLEAR_BIT(ICU_GPIO_REG(base, ICU_GPIO_IM_REG_OFFSET), Icu_Channels[Channel].Ch_Num);
+		Icu_ConfigureEdge(&Icu_Channels[Channel], Activation);
+		Icu_InputActive[Channel] = FALSE;
+		if(FALSE == masked)
+		{
+			SET_BIT(ICU_GPIO_REG(base, ICU_GPIO_IM_REG_OFFSET), Icu_Channels[Channel].Ch_Num);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Icu_DisableNotification
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to mask the channel interrupt, the edges are still latched for Icu_GetInputState.
+************************************************************************************/
+void Icu_DisableNotification(Icu_ChannelType Channel)
+{
+	if(FALSE == Icu_CheckChannel(Channel, ICU_DISABLE_NOTIFICATION_SID))
+	{
+		CLEAR_BIT(ICU_GPIO_REG(Icu_PortBaseAddress[Icu_Channels[Channel].Port_Num], ICU_GPIO_IM_REG_OFFSET),
+		          Icu_Channels[Channel].Ch_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Icu_EnableNotification
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to unmask the channel interrupt, the notification is called on every detected edge.
+*              An edge latched while the notification was disabled is notified immediately.
+************************************************************************************/
+void Icu_EnableNotification(Icu_ChannelType Channel)
+{
+	if(FALSE == Icu_CheckChannel(Channel, ICU_ENABLE_NOTIFICATION_SID))
+	{
+		SET_BIT(ICU_GPIO_REG(Icu_PortBaseAddress[Icu_Channels[Channel].Port_Num], ICU_GPIO_IM_REG_OFFSET),
+		        Icu_Channels[Channel].Ch_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Icu_GetInputState
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Icu_InputStateType - ICU_ACTIVE if an edge was detected since the last call else ICU_IDLE
+* Description: Function to read and clear the edge detected state of a channel.
+************************************************************************************/
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel)
+{
+	Icu_InputStateType state = ICU_IDLE;
+	uint32 base;
+
+	if(FALSE == Icu_CheckChannel(Channel, ICU_GET_INPUT_STATE_SID))
+	{
+		base = Icu_PortBaseAddress[Icu_Channels[Channel].Port_Num];
+
+		/* Edge latched in the raw status while the notification is disabled */
+		if(BIT_IS_SET(ICU_GPIO_REG(base, ICU_GPIO_RIS_REG_OFFSET), Icu_Channels[Channel].Ch_Num)
+		&& BIT_IS_CLEAR(ICU_GPIO_REG(base, ICU_GPIO_IM_REG_OFFSET), Icu_Channels[Channel].Ch_Num))
+		{
+			ICU_GPIO_REG(base, ICU_GPIO_ICR_REG_OFFSET) = (1UL << Icu_Channels[Channel].Ch_Num);
+			Icu_InputActive[Channel] = TRUE;
+		}
+
+		if(TRUE == Icu_InputActive[Channel])
+		{
+			Icu_InputActive[Channel] = FALSE;
+			state = ICU_ACTIVE;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return state;
+}
@@ -0,0 +1,178 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Icu Driver
+ *              (signal edge detection on the GPIO pins using the GPIO Ports interrupts)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef ICU_H
+#define ICU_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define ICU_VENDOR_ID    (1000U)
+
+/* Icu Module Id */
+#define ICU_MODULE_ID    (122U)
+
+/* Icu Instance Id */
+#define ICU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_SW_MAJOR_VERSION           (1U)
+#define ICU_SW_MINOR_VERSION           (0U)
+#define ICU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define ICU_AR_RELEASE_MINOR_VERSION   (0U)
+#define ICU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Icu Status
+ */
+#define ICU_INITIALIZED                (1U)
+#define ICU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Icu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Icu Pre-Compile Configuration Header file */
+#include "Icu_Cfg.h"
+
+/* AUTOSAR Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (ICU_CFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (ICU_CFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION)\
+ ||  (ICU_CFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION)\
+ ||  (ICU_CFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+  #error "The SW version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for ICU Init */
+#define ICU_INIT_SID                         (uint8)0x00
+
+/* Service ID for ICU Set Activation Condition */
+#define ICU_SET_ACTIVATION_CONDITION_SID     (uint8)0x04
+
+/* Service ID for ICU Disable Notification */
+#define ICU_DISABLE_NOTIFICATION_SID         (uint8)0x05
+
+/* Service ID for ICU Enable Notification */
+#define ICU_ENABLE_NOTIFICATION_SID          (uint8)0x06
+
+/* Service ID for ICU Get Input State */
+#define ICU_GET_INPUT_STATE_SID              (uint8)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Icu_Init API service called with NULL pointer parameter */
+#define ICU_E_PARAM_CONFIG                   (uint8)0x0A
+
+/* DET code to report Invalid Channel */
+#define ICU_E_PARAM_CHANNEL                  (uint8)0x0B
+
+/* DET code to report Invalid Activation edge */
+#define ICU_E_PARAM_ACTIVATION               (uint8)0x0C
+
+/* API service used without module initialization */
+#define ICU_E_UNINIT                         (uint8)0x14
+
+/* Icu_Init API service called while the module is already initialized */
+#define ICU_E_ALREADY_INITIALIZED            (uint8)0x17
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Icu_ChannelType used by the ICU APIs */
+typedef uint8 Icu_ChannelType;
+
+/* Type definition for Icu_ActivationType used by the ICU APIs */
+typedef enum
+{
+    ICU_RISING_EDGE, ICU_FALLING_EDGE, ICU_BOTH_EDGES
+}Icu_ActivationType;
+
+/* Type definition for Icu_InputStateType used by the ICU APIs */
+typedef enum
+{
+    ICU_ACTIVE, ICU_IDLE
+}Icu_InputStateType;
+
+/* Type definition for the notification called from the GPIO Port interrupt when the edge is detected */
+typedef void (*Icu_NotifyFunctionType)(void);
+
+typedef struct
+{
+	/* Member contains the ID of the Port that this channel belongs to */
+	uint8 Port_Num;
+	/* Member contains the ID of the Channel (pin number in the port) */
+	uint8 Ch_Num;
+	/* Member contains the edge detected after Icu_Init */
+	Icu_ActivationType DefaultStartEdge;
+	/* Member contains the notification function (NULL_PTR if not used) */
+	Icu_NotifyFunctionType Notification;
+}Icu_ConfigChannel;
+
+/* Data Structure required for initializing the Icu Driver */
+typedef struct Icu_ConfigType
+{
+	Icu_ConfigChannel Channels[ICU_CONFIGURED_CHANNELS];
+} Icu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for ICU Initialization API */
+void Icu_Init(const Icu_ConfigType * ConfigPtr);
+
+/* Function for ICU Set Activation Condition API */
+void Icu_SetActivationCondition(Icu_ChannelType Channel, Icu_ActivationType Activation);
+
+/* Function for ICU Disable Notification API */
+void Icu_DisableNotification(Icu_ChannelType Channel);
+
+/* Function for ICU Enable Notification API */
+void Icu_EnableNotification(Icu_ChannelType Channel);
+
+/* Function for ICU Get Input State API */
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Icu and other modules */
+extern const Icu_ConfigType Icu_Configuration;
+
+#endif /* ICU_H */
@@ -0,0 +1,47 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Icu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef ICU_CFG_H
+#define ICU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_CFG_SW_MAJOR_VERSION              (1U)
+#define ICU_CFG_SW_MINOR_VERSION              (0U)
+#define ICU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define ICU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define ICU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define ICU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Priority of the GPIO Ports interrupts (0 highest .. 7 lowest), above the SysTick priority 3 */
+#define ICU_INTERRUPT_PRIORITY              (2U)
+
+/* Number of the configured Icu Channels */
+#define ICU_CONFIGURED_CHANNELS             (1U)
+
+/* Channel Index in the array of structures in Icu_PBcfg.c */
+#define IcuConf_SW1_CHANNEL_ID_INDEX        (uint8)0x00
+
+/* ICU Configured Port ID's  */
+#define IcuConf_SW1_PORT_NUM                (uint8)5 /* PORTF */
+
+/* ICU Configured Channel ID's */
+#define IcuConf_SW1_CHANNEL_NUM             (uint8)4 /* Pin 4 in PORTF */
+
+#endif /* ICU_CFG_H */
@@ -0,0 +1,46 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Icu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Icu.h"
+#include "App.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define ICU_PBCFG_SW_MINOR_VERSION              (0U)
+#define ICU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define ICU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define ICU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (ICU_PBCFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (ICU_PBCFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION)\
+ ||  (ICU_PBCFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION)\
+ ||  (ICU_PBCFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Icu_Init API --> Port, Pin, Start edge, Notification */
+const Icu_ConfigType Icu_Configuration = {
+                                             IcuConf_SW1_PORT_NUM,IcuConf_SW1_CHANNEL_NUM,ICU_BOTH_EDGES,App_Sw1EdgeNotification
+                                         };
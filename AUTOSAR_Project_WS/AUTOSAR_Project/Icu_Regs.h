@@ -0,0 +1,45 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Icu Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef ICU_REGS_H
+#define ICU_REGS_H
+
+#include "Std_Types.h"
+
+/* GPIO Registers base addresses */
+#define ICU_GPIO_PORTA_BASE_ADDRESS       0x40004000
+#define ICU_GPIO_PORTB_BASE_ADDRESS       0x40005000
+#define ICU_GPIO_PORTC_BASE_ADDRESS       0x40006000
+#define ICU_GPIO_PORTD_BASE_ADDRESS       0x40007000
+#define ICU_GPIO_PORTE_BASE_ADDRESS       0x40024000
+#define ICU_GPIO_PORTF_BASE_ADDRESS       0x40025000
+
+/* GPIO Interrupt Registers offset addresses */
+#define ICU_GPIO_IS_REG_OFFSET            0x404     /* Interrupt Sense (0 = edge) */
+#define ICU_GPIO_IBE_REG_OFFSET           0x408     /* Interrupt Both Edges */
+#define ICU_GPIO_IEV_REG_OFFSET           0x40C     /* Interrupt Event (1 = rising edge) */
+#define ICU_GPIO_IM_REG_OFFSET            0x410     /* Interrupt Mask (1 = interrupt sent to the NVIC) */
+#define ICU_GPIO_RIS_REG_OFFSET           0x414     /* Raw Interrupt Status */
+#define ICU_GPIO_MIS_REG_OFFSET           0x418     /* Masked Interrupt Status */
+#define ICU_GPIO_ICR_REG_OFFSET           0x41C     /* Interrupt Clear */
+
+/* Access a GPIO interrupt register of the port at the given base address */
+#define ICU_GPIO_REG(BASE,OFFSET)         (*((volatile uint32 *)((BASE) + (OFFSET))))
+
+/* GPIO Ports interrupt numbers */
+#define ICU_GPIO_PORTA_IRQ                0
+#define ICU_GPIO_PORTB_IRQ                1
+#define ICU_GPIO_PORTC_IRQ                2
+#define ICU_GPIO_PORTD_IRQ                3
+#define ICU_GPIO_PORTE_IRQ                4
+#define ICU_GPIO_PORTF_IRQ                30
+
+#endif /* ICU_REGS_H */
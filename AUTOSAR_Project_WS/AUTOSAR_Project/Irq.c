@@ -0,0 +1,176 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Irq Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Irq.h"
+#include "Irq_Regs.h"
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Irq Modules */
+#if ((DET_AR_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Wait for the end of the vector table writes before the next exception entry */
+#define Data_Sync_Barrier()     __asm(" DSB ")
+
+STATIC uint8 Irq_Status = IRQ_NOT_INITIALIZED;
+
+/* Flash vector table in tm4c123gh6pm_startup_ccs.c */
+extern void (* const g_pfnVectors[])(void);
+
+/* Vector table used after Irq_Init, the .vtable section is placed at the start of the SRAM
+ * which meets the VTOR alignment (155 vectors --> 1024 bytes) */
+#pragma DATA_SECTION(Irq_RamVectors, ".vtable")
+#pragma DATA_ALIGN(Irq_RamVectors, 1024)
+STATIC Irq_HandlerType Irq_RamVectors[IRQ_NUMBER_OF_VECTORS];
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Irq module, the flash vector table is copied to
+*              RAM then VTOR points to the copy so the handlers can be changed at runtime
+*              and the vectors are fetched from the SRAM without the flash wait states.
+************************************************************************************/
+void Irq_Init(void)
+{
+	uint8 index;
+
+	for(index = 0; index < IRQ_NUMBER_OF_VECTORS; index++)
+	{
+		Irq_RamVectors[index] = g_pfnVectors[index];
+	}
+	Data_Sync_Barrier();
+	IRQ_SCB_VTOR_REG = (uint32)Irq_RamVectors;
+	Data_Sync_Barrier();
+	Irq_Status = IRQ_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Irq_Register
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different interrupts
+* Parameters (in): IrqNum - Number of the peripheral interrupt
+*                  Handler - Function called on the interrupt
+*                  Priority - Priority of the interrupt (0 --> highest)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to install the handler of a peripheral interrupt in the RAM vector
+*              table and set its priority, the interrupt is not enabled.
+************************************************************************************/
+void Irq_Register(Irq_NumberType IrqNum, Irq_HandlerType Handler, Irq_PriorityType Priority)
+{
+	boolean error = FALSE;
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+	if (IRQ_NOT_INITIALIZED == Irq_Status)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_UNINIT);
+		error = TRUE;
+	}
+	else if (IRQ_NUMBER_OF_INTERRUPTS <= IrqNum)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_IRQ);
+		error = TRUE;
+	}
+	else if (NULL_PTR == Handler)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else if (IRQ_NUMBER_OF_PRIORITIES <= Priority)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_PRIORITY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if(FALSE == error)
+	{
+		/* The vector is a single word write, it is valid for the next entry of the interrupt */
+		Irq_RamVectors[IRQ_NUMBER_OF_EXCEPTIONS + IrqNum] = Handler;
+		IRQ_NVIC_PRI_BYTE(IrqNum) = (uint8)(Priority << IRQ_NVIC_PRI_BITS_POS);
+		Data_Sync_Barrier();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Irq_EnableInterrupt
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): IrqNum - Number of the peripheral interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_EnableInterrupt(Irq_NumberType IrqNum)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+	if (IRQ_NUMBER_OF_INTERRUPTS <= IrqNum)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_ENABLE_INTERRUPT_SID, IRQ_E_PARAM_IRQ);
+	}
+	else
+#endif
+	{
+		/* Writing 0 to the other bits has no effect */
+		IRQ_NVIC_EN_REG(IrqNum) = (1UL << (IrqNum % 32));
+	}
+}
+
+/************************************************************************************
+* Service Name: Irq_DisableInterrupt
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): IrqNum - Number of the peripheral interrupt
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_DisableInterrupt(Irq_NumberType IrqNum)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+	if (IRQ_NUMBER_OF_INTERRUPTS <= IrqNum)
+	{
+		Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_DISABLE_INTERRUPT_SID, IRQ_E_PARAM_IRQ);
+	}
+	else
+#endif
+	{
+		/* Writing 0 to the other bits has no effect */
+		IRQ_NVIC_DIS_REG(IrqNum) = (1UL << (IrqNum % 32));
+	}
+}
@@ -0,0 +1,145 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Irq Driver, it moves the vector
+ *              table to RAM so the drivers install their interrupt handlers at init.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define IRQ_VENDOR_ID    (1000U)
+
+/* Irq Module Id (Complex Driver) */
+#define IRQ_MODULE_ID    (255U)
+
+/* Irq Instance Id */
+#define IRQ_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define IRQ_SW_MAJOR_VERSION           (1U)
+#define IRQ_SW_MINOR_VERSION           (0U)
+#define IRQ_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define IRQ_AR_RELEASE_MAJOR_VERSION   (4U)
+#define IRQ_AR_RELEASE_MINOR_VERSION   (0U)
+#define IRQ_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Irq Status
+ */
+#define IRQ_INITIALIZED                (1U)
+#define IRQ_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Irq Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Irq Pre-Compile Configuration Header file */
+#include "Irq_Cfg.h"
+
+/* AUTOSAR Version checking between Irq_Cfg.h and Irq.h files */
+#if ((IRQ_CFG_AR_RELEASE_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ ||  (IRQ_CFG_AR_RELEASE_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ ||  (IRQ_CFG_AR_RELEASE_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Irq_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Irq_Cfg.h and Irq.h files */
+#if ((IRQ_CFG_SW_MAJOR_VERSION != IRQ_SW_MAJOR_VERSION)\
+ ||  (IRQ_CFG_SW_MINOR_VERSION != IRQ_SW_MINOR_VERSION)\
+ ||  (IRQ_CFG_SW_PATCH_VERSION != IRQ_SW_PATCH_VERSION))
+  #error "The SW version of Irq_Cfg.h does not match the expected version"
+#endif
+
+/* Number of the Cortex-M4 exception vectors (stack pointer, reset, faults, SVCall, PendSV, SysTick) */
+#define IRQ_NUMBER_OF_EXCEPTIONS       (16U)
+
+/* Number of the peripheral interrupts of the TM4C123GH6PM, interrupt n uses the vector 16 + n */
+#define IRQ_NUMBER_OF_INTERRUPTS       (139U)
+
+/* Number of the vectors of g_pfnVectors in tm4c123gh6pm_startup_ccs.c */
+#define IRQ_NUMBER_OF_VECTORS          (IRQ_NUMBER_OF_EXCEPTIONS + IRQ_NUMBER_OF_INTERRUPTS)
+
+/* Number of the interrupt priority levels (3 bits), 0 is the highest priority */
+#define IRQ_NUMBER_OF_PRIORITIES       (8U)
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for IRQ Init */
+#define IRQ_INIT_SID                   (uint8)0x00
+
+/* Service ID for IRQ Register */
+#define IRQ_REGISTER_SID               (uint8)0x01
+
+/* Service ID for IRQ Enable Interrupt */
+#define IRQ_ENABLE_INTERRUPT_SID       (uint8)0x02
+
+/* Service ID for IRQ Disable Interrupt */
+#define IRQ_DISABLE_INTERRUPT_SID      (uint8)0x03
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called with an interrupt number out of range */
+#define IRQ_E_PARAM_IRQ                (uint8)0x0A
+
+/* API service called with a NULL handler */
+#define IRQ_E_PARAM_POINTER            (uint8)0x0B
+
+/* API service called with a priority out of range */
+#define IRQ_E_PARAM_PRIORITY           (uint8)0x0C
+
+/* Irq_Register called before Irq_Init */
+#define IRQ_E_UNINIT                   (uint8)0x0D
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the number of a peripheral interrupt (vector 16 + n) */
+typedef uint8 Irq_NumberType;
+
+/* Type definition for the priority of an interrupt, 0 is the highest priority */
+typedef uint8 Irq_PriorityType;
+
+/* Type definition for an interrupt handler */
+typedef void (*Irq_HandlerType)(void);
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for IRQ Initialization API ... it copies the flash vector table to RAM and points VTOR to it */
+void Irq_Init(void);
+
+/* Function for IRQ Register API ... it installs the handler of a peripheral interrupt and sets its priority,
+ * the interrupt is enabled separately by Irq_EnableInterrupt or by the driver */
+void Irq_Register(Irq_NumberType IrqNum, Irq_HandlerType Handler, Irq_PriorityType Priority);
+
+/* Function to enable a peripheral interrupt in the NVIC */
+void Irq_EnableInterrupt(Irq_NumberType IrqNum);
+
+/* Function to disable a peripheral interrupt in the NVIC */
+void Irq_DisableInterrupt(Irq_NumberType IrqNum);
+
+#endif /* IRQ_H */
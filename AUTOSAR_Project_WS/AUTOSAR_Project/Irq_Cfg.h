@@ -0,0 +1,32 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Irq Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef IRQ_CFG_H
+#define IRQ_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define IRQ_CFG_SW_MAJOR_VERSION              (1U)
+#define IRQ_CFG_SW_MINOR_VERSION              (0U)
+#define IRQ_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define IRQ_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define IRQ_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define IRQ_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define IRQ_DEV_ERROR_DETECT                (STD_ON)
+
+#endif /* IRQ_CFG_H */
@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Irq Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef IRQ_REGS_H
+#define IRQ_REGS_H
+
+#include "Std_Types.h"
+
+/* Cortex-M4 Vector Table Offset register, the table must be aligned on its size rounded up to a power of 2 */
+#define IRQ_SCB_VTOR_REG                  (*((volatile uint32 *)0xE000ED08))
+
+/* NVIC Interrupt Set Enable, Clear Enable registers and Interrupt Priority byte of an interrupt */
+#define IRQ_NVIC_EN_REG(IRQ)              (*((volatile uint32 *)(0xE000E100 + (((IRQ) / 32) * 4))))
+#define IRQ_NVIC_DIS_REG(IRQ)             (*((volatile uint32 *)(0xE000E180 + (((IRQ) / 32) * 4))))
+#define IRQ_NVIC_PRI_BYTE(IRQ)            (*((volatile uint8 *)(0xE000E400 + (IRQ))))
+#define IRQ_NVIC_PRI_BITS_POS             5
+
+#endif /* IRQ_REGS_H */
@@ -11,6 +11,116 @@
 #include "Port.h"
 #include "Dio.h"
 #include "Led.h"
+#if (LED_BACKEND == LED_BACKEND_PWM)
+#include "Pwm.h"
+#else
+#include "SwPwm.h"
+#endif
+#include "Os.h"
+
+/* End of the list of the playing LEDs */
+#define LED_NO_CHANNEL  (0xFFU)
+
+/* TRUE once the pattern time reaches the time T (the times wrap around) */
+#define LED_TIME_REACHED(T)  ((boolean)((uint32)(g_Led_PatternTime - (T)) < 0x80000000UL))
+
+/* Description: Structure of the pattern played on a LED channel:
+ *  1. the pattern (NULL_PTR if none)
+ *  2. the current step
+ *  3. the number of plays of the steps done
+ *  4. the pattern time at the end of the current step
+ *  5. the next LED in the list of the playing LEDs
+ */
+typedef struct
+{
+    const Led_PatternType * Pattern;
+    uint8 Step;
+    uint8 Plays;
+    uint32 StepEnd;
+    Led_ChannelType Next;
+}Led_PatternStateType;
+
+/* State of the LED and its brightness while it is ON */
+static boolean g_Led_On = FALSE;
+static uint8 g_Led_Brightness = LED_BRIGHTNESS_DEFAULT;
+
+/* Pwm or SwPwm channel of each LED channel */
+static const uint8 g_Led_PwmChannels[LED_NUMBER_OF_CHANNELS] = LED_PWM_CHANNELS;
+
+/* Patterns of the LED channels and the playing LEDs sorted by the end of their step */
+static Led_PatternStateType g_Led_Patterns[LED_NUMBER_OF_CHANNELS];
+static Led_ChannelType g_Led_PatternHead = LED_NO_CHANNEL;
+
+/* Time in Mili-seconds advanced by Led_PatternTick */
+static uint32 g_Led_PatternTime = 0;
+
+/*********************************************************************************************/
+/* Description: Set the duty cycle of the Pwm or SwPwm channel of a LED from a brightness */
+static void Led_SetChannelOutput(Led_ChannelType Channel, uint8 Brightness)
+{
+#if (LED_BACKEND == LED_BACKEND_PWM)
+    Pwm_SetDutyCycle(g_Led_PwmChannels[Channel], (Pwm_DutyCycleType)(((uint32)Brightness * PWM_DUTY_MAX) / LED_BRIGHTNESS_MAX));
+#else
+    SwPwm_SetDutyCycle(g_Led_PwmChannels[Channel], (SwPwm_DutyCycleType)(((uint32)Brightness * SWPWM_DUTY_MAX) / LED_BRIGHTNESS_MAX));
+#endif
+}
+
+/*********************************************************************************************/
+/* Description: Set the output of the main LED from its state and brightness, a pattern played on it keeps the output */
+static void Led_ApplyOutput(void)
+{
+    if(g_Led_Patterns[LED_MAIN_CHANNEL].Pattern == NULL_PTR)
+    {
+        Led_SetChannelOutput(LED_MAIN_CHANNEL, (g_Led_On == TRUE) ? g_Led_Brightness : 0U);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Insert a playing LED in the list after the LEDs with an earlier or the same step end,
+ *              called with the interrupts disabled */
+static void Led_InsertPattern(Led_ChannelType Channel)
+{
+    Led_ChannelType * link = &g_Led_PatternHead;
+    uint32 end = g_Led_Patterns[Channel].StepEnd;
+
+    while((*link != LED_NO_CHANNEL) && ((uint32)(end - g_Led_Patterns[*link].StepEnd) < 0x80000000UL))
+    {
+        link = &g_Led_Patterns[*link].Next;
+    }
+    g_Led_Patterns[Channel].Next = *link;
+    *link = Channel;
+}
+
+/*********************************************************************************************/
+/* Description: Remove the pattern of a LED and its place in the list, called with the interrupts disabled */
+static void Led_RemovePattern(Led_ChannelType Channel)
+{
+    Led_ChannelType * link = &g_Led_PatternHead;
+
+    if(g_Led_Patterns[Channel].Pattern != NULL_PTR)
+    {
+        while(*link != Channel)
+        {
+            link = &g_Led_Patterns[*link].Next;
+        }
+        *link = g_Led_Patterns[Channel].Next;
+        g_Led_Patterns[Channel].Pattern = NULL_PTR;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Output of a LED without pattern: the main LED state or OFF */
+static void Led_EndPattern(Led_ChannelType Channel)
+{
+    if(Channel == LED_MAIN_CHANNEL)
+    {
+        Led_ApplyOutput();
+    }
+    else
+    {
+        Led_SetChannelOutput(Channel, 0U);
+    }
+}
 
 ///* LED Configurations Structure */
 //static Port_ConfigType  g_LED_Config;
@@ -39,26 +149,128 @@
 /*********************************************************************************************/
 void Led_SetOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    Led_StopPattern(LED_MAIN_CHANNEL);
+    g_Led_On = TRUE;
+    Led_ApplyOutput();  /* LED ON */
 }
 
 /*********************************************************************************************/
 void Led_SetOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    Led_StopPattern(LED_MAIN_CHANNEL);
+    g_Led_On = FALSE;
+    Led_ApplyOutput(); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    Led_ApplyOutput(); /* re-apply the same duty cycle, the driver only updates its output when it changes */
 }
 
 /*********************************************************************************************/
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Led_StopPattern(LED_MAIN_CHANNEL);
+    g_Led_On = (boolean)(g_Led_On == FALSE);
+    Led_ApplyOutput();
+}
+
+/*********************************************************************************************/
+void Led_SetBrightness(uint8 Brightness)
+{
+    Led_StopPattern(LED_MAIN_CHANNEL);
+    g_Led_Brightness = Brightness;
+    Led_ApplyOutput();
+}
+
+/*********************************************************************************************/
+Std_ReturnType Led_PlayPattern(Led_ChannelType Channel, const Led_PatternType * Pattern)
+{
+    Std_ReturnType status = E_NOT_OK;
+    uint32 duration = 0;
+    uint8 step;
+
+    if((Channel < LED_NUMBER_OF_CHANNELS) && (Pattern != NULL_PTR) && (Pattern->Steps != NULL_PTR))
+    {
+        for(step = 0; step < Pattern->NumberOfSteps; step++)
+        {
+            duration += Pattern->Steps[step].Duration;
+        }
+    }
+
+    /* A pattern without duration would never leave Led_PatternTick */
+    if(duration != 0U)
+    {
+        SuspendAllInterrupts();
+        Led_RemovePattern(Channel);
+        g_Led_Patterns[Channel].Pattern = Pattern;
+        g_Led_Patterns[Channel].Step    = 0;
+        g_Led_Patterns[Channel].Plays   = 0;
+        g_Led_Patterns[Channel].StepEnd = g_Led_PatternTime + Pattern->Steps[0].Duration;
+        Led_InsertPattern(Channel);
+        Led_SetChannelOutput(Channel, Pattern->Steps[0].Brightness);
+        ResumeAllInterrupts();
+        status = E_OK;
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+void Led_StopPattern(Led_ChannelType Channel)
+{
+    if((Channel < LED_NUMBER_OF_CHANNELS) && (g_Led_Patterns[Channel].Pattern != NULL_PTR))
+    {
+        SuspendAllInterrupts();
+        Led_RemovePattern(Channel);
+        ResumeAllInterrupts();
+        Led_EndPattern(Channel);
+    }
+}
+
+/*********************************************************************************************/
+boolean Led_PatternIsPlaying(Led_ChannelType Channel)
+{
+    return (boolean)((Channel < LED_NUMBER_OF_CHANNELS) && (g_Led_Patterns[Channel].Pattern != NULL_PTR));
+}
+
+/*********************************************************************************************/
+void Led_PatternTick(void)
+{
+    Led_PatternStateType * state;
+    Led_ChannelType channel;
+
+    SuspendAllInterrupts();
+    g_Led_PatternTime += LED_PATTERN_TICK_MS;
+
+    /* The LEDs after the first one with a step still running have later step ends */
+    while((g_Led_PatternHead != LED_NO_CHANNEL) && (LED_TIME_REACHED(g_Led_Patterns[g_Led_PatternHead].StepEnd) == TRUE))
+    {
+        channel = g_Led_PatternHead;
+        state = &g_Led_Patterns[channel];
+        g_Led_PatternHead = state->Next;
+
+        state->Step++;
+        if(state->Step >= state->Pattern->NumberOfSteps)
+        {
+            state->Step = 0;
+            state->Plays++;
+        }
+
+        if((state->Step == 0U) && (state->Pattern->Repeat != LED_PATTERN_FOREVER) && (state->Plays >= state->Pattern->Repeat))
+        {
+            state->Pattern = NULL_PTR;
+            Led_EndPattern(channel);
+        }
+        else
+        {
+            /* From the end of the previous step, the steps do not drift with the tick rounding */
+            state->StepEnd += state->Pattern->Steps[state->Step].Duration;
+            Led_InsertPattern(channel);
+            Led_SetChannelOutput(channel, state->Pattern->Steps[state->Step].Brightness);
+        }
+    }
+    ResumeAllInterrupts();
 }
 
 /*********************************************************************************************/
@@ -12,8 +12,41 @@
 #define LED_H
 
 #include "Std_Types.h"
+
+/* Brightness of a fully ON LED */
+#define LED_BRIGHTNESS_MAX  (255U)
+
+/* Repeat count of a pattern played until Led_StopPattern or another pattern */
+#define LED_PATTERN_FOREVER (0U)
+
 #include "Led_Cfg.h"
 
+/* Type definition for the LED channels (LedConf_xxx_CHANNEL_ID_INDEX) */
+typedef uint8 Led_ChannelType;
+
+/* Description: Structure of a step of a pattern:
+ *  1. the brightness of the LED during the step (0 --> OFF .. LED_BRIGHTNESS_MAX)
+ *  2. the duration of the step in Mili-seconds, it ends on the first Led_PatternTick at or after it
+ */
+typedef struct
+{
+    uint8 Brightness;
+    uint16 Duration;
+}Led_PatternStepType;
+
+/* Description: Structure of a pattern played by Led_PlayPattern (const descriptors shared by the LEDs):
+ *  1. the steps played in order
+ *  2. the number of steps
+ *  3. the number of plays of the steps (LED_PATTERN_FOREVER to play them until stopped),
+ *     then the LED gets back the state set by Led_SetOn/Led_SetOff (main channel) or OFF
+ */
+typedef struct
+{
+    const Led_PatternStepType * Steps;
+    uint8 NumberOfSteps;
+    uint8 Repeat;
+}Led_PatternType;
+
 /* Description: 1. Fill the led configurations structure 
  *              2. Set the PIN direction which the led is connected as OUTPUT pin
  *		        3. Initialize the led ON/OFF according to the initial value
@@ -32,4 +65,23 @@ void Led_Toggle(void);
 /* Description: Refresh the LED state */
 void Led_RefreshOutput(void);
 
+/* Description: Set the brightness of the LED while it is ON (0 .. LED_BRIGHTNESS_MAX), the LED is dimmed by Pwm or SwPwm */
+void Led_SetBrightness(uint8 Brightness);
+
+/* Description: Play a pattern on a LED channel from its first step, it replaces the pattern played on it,
+ *              E_NOT_OK for an invalid channel or a pattern without duration.
+ *              The functions above control LED_MAIN_CHANNEL, they stop the pattern played on it */
+Std_ReturnType Led_PlayPattern(Led_ChannelType Channel, const Led_PatternType * Pattern);
+
+/* Description: Stop the pattern played on a LED channel */
+void Led_StopPattern(Led_ChannelType Channel);
+
+/* Description: TRUE while a pattern is played on the LED channel */
+boolean Led_PatternIsPlaying(Led_ChannelType Channel);
+
+/* Description: Called every LED_PATTERN_TICK_MS by the Led Task, it moves the LEDs with a step ending
+ *              to their next step ... only these LEDs are processed, they are at the head of a list
+ *              of the playing LEDs sorted by the end of their current step */
+void Led_PatternTick(void);
+
 #endif /* LED_H */
@@ -22,4 +22,31 @@
 /* Set the LED Pin Number */
 #define LED_PIN_NUM DioConf_LED1_CHANNEL_NUM
 
+/* Driver which dims the LEDs (LED_BACKEND), shared with the Port configuration */
+#include "Board_Cfg.h"
+
+/* Number of the LED channels */
+#define LED_NUMBER_OF_CHANNELS (3U)
+
+/* LED channel Index */
+#define LedConf_RED_CHANNEL_ID_INDEX    (uint8)0x00
+#define LedConf_BLUE_CHANNEL_ID_INDEX   (uint8)0x01
+#define LedConf_GREEN_CHANNEL_ID_INDEX  (uint8)0x02
+
+/* LED channel controlled by Led_SetOn, Led_SetOff, Led_Toggle and Led_SetBrightness */
+#define LED_MAIN_CHANNEL LedConf_RED_CHANNEL_ID_INDEX
+
+/* Pwm or SwPwm channel which drives each LED channel */
+#if (LED_BACKEND == LED_BACKEND_PWM)
+#define LED_PWM_CHANNELS { PwmConf_LED_RED_CHANNEL_ID_INDEX, PwmConf_LED_BLUE_CHANNEL_ID_INDEX, PwmConf_LED_GREEN_CHANNEL_ID_INDEX }
+#else
+#define LED_PWM_CHANNELS { SwPwmConf_LED_RED_CHANNEL_ID_INDEX, SwPwmConf_LED_BLUE_CHANNEL_ID_INDEX, SwPwmConf_LED_GREEN_CHANNEL_ID_INDEX }
+#endif
+
+/* Period of Led_Task in the OS_SCHTBL_PERIODIC schedule table, the pattern steps end on its ticks */
+#define LED_PATTERN_TICK_MS (40U)
+
+/* Brightness of the LED while it is ON until Led_SetBrightness is called */
+#define LED_BRIGHTNESS_DEFAULT LED_BRIGHTNESS_MAX
+
 #endif /* LED_CFG_H_ */
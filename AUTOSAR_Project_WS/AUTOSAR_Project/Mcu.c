@@ -9,11 +9,518 @@
  * Author: Mohamed Tarek
  ******************************************************************************/
 
+#include "Mcu.h"
+#include "Mcu_Regs.h"
+#include "Common_Macros.h"
 #include "tm4c123gh6pm_registers.h"
 
-void Mcu_Init(void)
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Mcu Modules */
+#if ((DET_AR_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Wait for an interrupt in the sleep or deep-sleep mode */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+STATIC const Mcu_ConfigType * Mcu_ConfigPtr = NULL_PTR;
+STATIC uint8 Mcu_Status = MCU_NOT_INITIALIZED;
+
+/* System clock frequency in Hz, the device runs from the PIOSC after reset */
+STATIC uint32 Mcu_SysClockFrequency = MCU_PIOSC_FREQUENCY_HZ;
+
+/* RESC register value latched by the first Mcu_Init, the register itself is cleared for the next reset */
+STATIC Mcu_RawResetType Mcu_ResetRawValue = 0;
+
+/* Clock setting whose PLL was started by Mcu_InitClock, used after Mcu_DistributePllClock */
+STATIC const Mcu_ClockSettingConfigType * Mcu_PendingPllSetting = NULL_PTR;
+
+/************************************************************************************
+* Description: Publish the new system clock frequency then notify the configured consumers
+*              so they rescale their timers
+************************************************************************************/
+STATIC void Mcu_ClockChanged(uint32 Frequency)
+{
+    uint8 index;
+
+    Mcu_SysClockFrequency = Frequency;
+
+    for(index = 0; index < MCU_NUMBER_OF_CLOCK_NOTIFICATIONS; index++)
+    {
+        if(NULL_PTR != Mcu_ConfigPtr->ClockNotifications[index])
+        {
+            (*Mcu_ConfigPtr->ClockNotifications[index])();
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu module and enable the clock of all the GPIO Ports,
+*              the system clock is changed later by Mcu_InitClock. The reset cause is latched
+*              then cleared so the next reset reports only its own cause. The sleep modes are set to
+*              gate the peripherals clocks according to the mode settings.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+             MCU_E_PARAM_CONFIG);
+    }
+    else
+#endif
+    {
+        /* RESC accumulates the causes until it is cleared, it is read once per reset */
+        if(MCU_NOT_INITIALIZED == Mcu_Status)
+        {
+            Mcu_ResetRawValue = SYSCTL_RESC_REG;
+            SYSCTL_RESC_REG   = 0;
+        }
+
+        Mcu_ConfigPtr = ConfigPtr;
+        Mcu_Status    = MCU_INITIALIZED;
+
+        /* Enable clock for All PORTs and wait for clock to start */
+        SYSCTL_RCGCGPIO_REG |= 0x3F;
+        while(!(SYSCTL_PRGPIO_REG & 0x3F));
+
+        /* The sleep and deep-sleep modes clock the peripherals selected by the SCGC and DCGC registers */
+        SET_BIT(SYSCTL_RCC_REG, MCU_RCC_ACG_BIT);
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetResetReason
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_ResetType - Cause of the last reset
+* Description: Function to decode the reset cause latched by Mcu_Init, a power-on or brown-out
+*              reset also sets the other bits which happened in the same power cycle so they
+*              are checked first.
+************************************************************************************/
+Mcu_ResetType Mcu_GetResetReason(void)
+{
+    Mcu_ResetType reason = MCU_RESET_UNDEFINED;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GET_RESET_REASON_SID, MCU_E_UNINIT);
+    }
+    else
+#endif
+    {
+        if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_POR_BIT))
+        {
+            reason = MCU_POWER_ON_RESET;
+        }
+        else if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_BOR_BIT))
+        {
+            reason = MCU_BROWNOUT_RESET;
+        }
+        else if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_WDT0_BIT) || BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_WDT1_BIT))
+        {
+            reason = MCU_WATCHDOG_RESET;
+        }
+        else if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_SW_BIT))
+        {
+            reason = MCU_SW_RESET;
+        }
+        else if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_MOSCFAIL_BIT))
+        {
+            reason = MCU_OSC_FAILURE_RESET;
+        }
+        else if(BIT_IS_SET(Mcu_ResetRawValue, MCU_RESC_EXT_BIT))
+        {
+            reason = MCU_EXTERNAL_RESET;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return reason;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetResetRawValue
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_RawResetType - RESC register value latched by Mcu_Init
+* Description: Function to return the reset cause bits as read from the RESC register.
+************************************************************************************/
+Mcu_RawResetType Mcu_GetResetRawValue(void)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GET_RESET_RAW_VALUE_SID, MCU_E_UNINIT);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+    return Mcu_ResetRawValue;
+}
+
+#if (MCU_PERFORM_RESET_API == STD_ON)
+/************************************************************************************
+* Service Name: Mcu_PerformReset
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to request a software reset of the whole device, the .noinit RAM
+*              section is kept so the modules can restore their state after the reset.
+************************************************************************************/
+void Mcu_PerformReset(void)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_PERFORM_RESET_SID, MCU_E_UNINIT);
+    }
+    else
+#endif
+    {
+        MCU_SCB_APINT_REG = MCU_SCB_APINT_VECTKEY | (1UL << MCU_SCB_APINT_SYSRESREQ_BIT);
+        /* The reset happens a few cycles after the request */
+        while(1);
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Id of the clock setting (McuConf_CLOCK_xxx)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the clock setting is applied (or its PLL started)
+* Description: Function to apply a clock setting, it can be called at runtime to switch profile:
+*              - Bypass the PLL to run from the oscillator while the clock tree is changed
+*              - Select the oscillator source and the crystal, power up the main oscillator
+*              - Without PLL: power down the PLL, set the system divider, the new frequency is
+*                published and the consumers are notified
+*              - With PLL: power up the PLL and set the system divider of its 400 MHz output,
+*                the system clock stays on the oscillator until Mcu_DistributePllClock
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting)
+{
+    const Mcu_ClockSettingConfigType * clock;
+    uint32 rcc;
+    uint32 rcc2;
+    Std_ReturnType ret = E_OK;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_CLOCK_SID, MCU_E_UNINIT);
+        ret = E_NOT_OK;
+    }
+    else if (MCU_NUMBER_OF_CLOCK_SETTINGS <= ClockSetting)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_CLOCK_SID, MCU_E_PARAM_CLOCK);
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        clock = &Mcu_ConfigPtr->ClockSettings[ClockSetting];
+        if (((TRUE == clock->UsePll) && ((clock->SysDivider < MCU_PLL_MIN_SYSDIV) || (clock->SysDivider > MCU_PLL_MAX_SYSDIV)))
+         || ((FALSE == clock->UsePll) && ((clock->SysDivider == 0) || (clock->SysDivider > MCU_OSC_MAX_SYSDIV))))
+        {
+            Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_CLOCK_SID, MCU_E_PARAM_CLOCK);
+            ret = E_NOT_OK;
+        }
+    }
+#endif
+
+    if(E_OK == ret)
+    {
+        clock = &Mcu_ConfigPtr->ClockSettings[ClockSetting];
+        rcc   = SYSCTL_RCC_REG;
+        rcc2  = SYSCTL_RCC2_REG;
+
+        /* Run from the raw oscillator while the PLL and the system divider are changed */
+        SET_BIT(rcc, MCU_RCC_BYPASS_BIT);
+        CLEAR_BIT(rcc, MCU_RCC_USESYSDIV_BIT);
+        SET_BIT(rcc2, MCU_RCC2_USERCC2_BIT);
+        SET_BIT(rcc2, MCU_RCC2_BYPASS2_BIT);
+        SYSCTL_RCC_REG  = rcc;
+        SYSCTL_RCC2_REG = rcc2;
+
+        /* Select the crystal and power up the main oscillator when it is used */
+        rcc = (rcc & ~MCU_RCC_XTAL_MASK) | ((uint32)clock->Xtal << MCU_RCC_XTAL_POS);
+        if(MCU_OSC_MAIN == clock->OscSource)
+        {
+            CLEAR_BIT(rcc, MCU_RCC_MOSCDIS_BIT);
+            SYSCTL_RCC_REG = rcc;
+            while(BIT_IS_CLEAR(SYSCTL_RIS_REG, MCU_RIS_MOSCPUPRIS_BIT));
+        }
+        else
+        {
+            SYSCTL_RCC_REG = rcc;
+        }
+        rcc2 = (rcc2 & ~(MCU_RCC2_OSCSRC2_MASK | MCU_RCC2_SYSDIV2_MASK)) | ((uint32)clock->OscSource << MCU_RCC2_OSCSRC2_POS);
+
+        if(TRUE == clock->UsePll)
+        {
+            CLEAR_BIT(rcc2, MCU_RCC2_PWRDN2_BIT);
+            SET_BIT(rcc2, MCU_RCC2_DIV400_BIT);
+            rcc2 |= ((uint32)(clock->SysDivider - 1) << MCU_RCC2_SYSDIV2LSB_POS);
+            SET_BIT(rcc, MCU_RCC_USESYSDIV_BIT);
+            SYSCTL_RCC_REG  = rcc;
+            SYSCTL_RCC2_REG = rcc2;
+
+            Mcu_PendingPllSetting = clock;
+        }
+        else
+        {
+            SET_BIT(rcc2, MCU_RCC2_PWRDN2_BIT);
+            CLEAR_BIT(rcc2, MCU_RCC2_DIV400_BIT);
+            rcc2 |= ((uint32)(clock->SysDivider - 1) << MCU_RCC2_SYSDIV2_POS);
+            if(clock->SysDivider > 1)
+            {
+                SET_BIT(rcc, MCU_RCC_USESYSDIV_BIT);
+            }
+            SYSCTL_RCC_REG  = rcc;
+            SYSCTL_RCC2_REG = rcc2;
+
+            Mcu_PendingPllSetting = NULL_PTR;
+            Mcu_ClockChanged(clock->Frequency);
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the system clock is switched to the PLL
+* Description: Function to switch the system clock to the PLL started by Mcu_InitClock once it is
+*              locked, the new frequency is published and the consumers are notified.
+************************************************************************************/
+Std_ReturnType Mcu_DistributePllClock(void)
+{
+    Std_ReturnType ret = E_OK;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_UNINIT);
+        ret = E_NOT_OK;
+    }
+    else
+#endif
+    if ((NULL_PTR == Mcu_PendingPllSetting) || (MCU_PLL_LOCKED != Mcu_GetPllStatus()))
+    {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_PLL_NOT_LOCKED);
+#endif
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CLEAR_BIT(SYSCTL_RCC2_REG, MCU_RCC2_BYPASS2_BIT);
+        CLEAR_BIT(SYSCTL_RCC_REG, MCU_RCC_BYPASS_BIT);
+
+        Mcu_ClockChanged(Mcu_PendingPllSetting->Frequency);
+        Mcu_PendingPllSetting = NULL_PTR;
+    }
+    return ret;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - Lock status of the PLL
+* Description: Function to return the lock status of the PLL, unlocked while it is powered down.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+    Mcu_PllStatusType status;
+
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GET_PLL_STATUS_SID, MCU_E_UNINIT);
+#endif
+        status = MCU_PLL_STATUS_UNDEFINED;
+    }
+    else if (BIT_IS_SET(SYSCTL_RCC2_REG, MCU_RCC2_PWRDN2_BIT) || BIT_IS_CLEAR(SYSCTL_PLLSTAT_REG, MCU_PLLSTAT_LOCK_BIT))
+    {
+        status = MCU_PLL_UNLOCKED;
+    }
+    else
+    {
+        status = MCU_PLL_LOCKED;
+    }
+    return status;
+}
+
+/************************************************************************************
+* Service Name: Mcu_SetMode
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): McuMode - Id of the mode setting (McuConf_MODE_xxx)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enter a power mode until the next interrupt:
+*              - Run: return at once
+*              - Sleep: gate the peripherals clocks with the SCGC registers then WFI
+*              - Deep-sleep: gate with the DCGC registers, select the deep-sleep clock then WFI
+*              It should be called with the interrupts disabled (PRIMASK), the pending interrupt
+*              still wakes the core up and runs once the interrupts are enabled again.
+************************************************************************************/
+void Mcu_SetMode(Mcu_ModeType McuMode)
+{
+    const Mcu_ModeSettingConfigType * mode;
+    boolean error = FALSE;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_SET_MODE_SID, MCU_E_UNINIT);
+        error = TRUE;
+    }
+    else if ((MCU_NUMBER_OF_MODES <= McuMode) || (MCU_MODE_NOT_AVAILABLE == Mcu_GetModeWakeupLatency(McuMode)))
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_SET_MODE_SID, MCU_E_PARAM_MODE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    if(FALSE == error)
+    {
+        mode = &Mcu_ConfigPtr->ModeSettings[McuMode];
+
+        if(MCU_POWER_SLEEP == mode->PowerMode)
+        {
+            SYSCTL_SCGCGPIO_REG   = mode->ClockGating.Gpio;
+            SYSCTL_SCGCTIMER_REG  = mode->ClockGating.Timer;
+            SYSCTL_SCGCWTIMER_REG = mode->ClockGating.WideTimer;
+            SYSCTL_SCGCUART_REG   = mode->ClockGating.Uart;
+            SYSCTL_SCGCPWM_REG    = mode->ClockGating.Pwm;
+
+            CLEAR_BIT(MCU_SCB_SCR_REG, MCU_SCB_SCR_SLEEPDEEP_BIT);
+            Wait_For_Interrupt();
+        }
+        else if(MCU_POWER_DEEPSLEEP == mode->PowerMode)
+        {
+            SYSCTL_DCGCGPIO_REG   = mode->ClockGating.Gpio;
+            SYSCTL_DCGCTIMER_REG  = mode->ClockGating.Timer;
+            SYSCTL_DCGCWTIMER_REG = mode->ClockGating.WideTimer;
+            SYSCTL_DCGCUART_REG   = mode->ClockGating.Uart;
+            SYSCTL_DCGCPWM_REG    = mode->ClockGating.Pwm;
+
+            SYSCTL_DSLPCLKCFG_REG = ((uint32)mode->DeepSleepOsc << MCU_DSLPCLKCFG_DSOSCSRC_POS)
+                                  | ((uint32)(mode->DeepSleepDivider - 1) << MCU_DSLPCLKCFG_DSDIVORIDE_POS);
+
+            SET_BIT(MCU_SCB_SCR_REG, MCU_SCB_SCR_SLEEPDEEP_BIT);
+            Wait_For_Interrupt();
+            CLEAR_BIT(MCU_SCB_SCR_REG, MCU_SCB_SCR_SLEEPDEEP_BIT);
+        }
+        else
+        {
+            /* Run mode ... No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetModeWakeupLatency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): McuMode - Id of the mode setting (McuConf_MODE_xxx)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Wake-up latency in us, MCU_MODE_NOT_AVAILABLE if the mode can not be used
+* Description: Function to return the wake-up latency of a mode, a deep-sleep mode is not available
+*              when its clock differs from the current system clock (the SysTick and the timers
+*              would count at another rate while the core sleeps).
+************************************************************************************/
+uint32 Mcu_GetModeWakeupLatency(Mcu_ModeType McuMode)
+{
+    const Mcu_ModeSettingConfigType * mode;
+    uint32 latency = MCU_MODE_NOT_AVAILABLE;
+
+    if((MCU_INITIALIZED == Mcu_Status) && (McuMode < MCU_NUMBER_OF_MODES))
+    {
+        mode = &Mcu_ConfigPtr->ModeSettings[McuMode];
+        if((MCU_POWER_DEEPSLEEP != mode->PowerMode) || (mode->DeepSleepFrequency == Mcu_SysClockFrequency))
+        {
+            latency = mode->WakeupLatency;
+        }
+    }
+    return latency;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetSysClockFrequency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock frequency in Hz
+* Description: Function to return the system clock frequency of the last applied clock setting,
+*              the PIOSC frequency before the first one.
+************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void)
 {
-    /* Enable clock for All PORTs and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x3F;
-    while(!(SYSCTL_PRGPIO_REG & 0x3F));
+    return Mcu_SysClockFrequency;
 }
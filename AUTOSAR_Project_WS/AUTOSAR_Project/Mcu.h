@@ -13,8 +13,260 @@
 #ifndef MCU_H_
 #define MCU_H_
 
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define MCU_VENDOR_ID    (1000U)
+
+/* Mcu Module Id */
+#define MCU_MODULE_ID    (101U)
+
+/* Mcu Instance Id */
+#define MCU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_SW_MAJOR_VERSION           (1U)
+#define MCU_SW_MINOR_VERSION           (0U)
+#define MCU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define MCU_AR_RELEASE_MINOR_VERSION   (0U)
+#define MCU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Mcu Status
+ */
+#define MCU_INITIALIZED                (1U)
+#define MCU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
-void Mcu_Init(void);
+/* AUTOSAR checking between Std Types and Mcu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/* AUTOSAR Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_CFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_CFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Frequency of the precision internal oscillator (PIOSC) which clocks the system out of reset */
+#define MCU_PIOSC_FREQUENCY_HZ   (16000000UL)
+
+/* Frequency of the PLL output, the system clock is derived from it by the system divider */
+#define MCU_PLL_FREQUENCY_HZ     (400000000UL)
+
+/* Wake-up latency returned for a mode which can not be used with the current system clock */
+#define MCU_MODE_NOT_AVAILABLE   (0xFFFFFFFFUL)
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for MCU Init */
+#define MCU_INIT_SID                         (uint8)0x00
+
+/* Service ID for MCU Init Clock */
+#define MCU_INIT_CLOCK_SID                   (uint8)0x02
+
+/* Service ID for MCU Distribute Pll Clock */
+#define MCU_DISTRIBUTE_PLL_CLOCK_SID         (uint8)0x03
+
+/* Service ID for MCU Get Pll Status */
+#define MCU_GET_PLL_STATUS_SID               (uint8)0x04
+
+/* Service ID for MCU Get Reset Reason */
+#define MCU_GET_RESET_REASON_SID             (uint8)0x05
+
+/* Service ID for MCU Get Reset Raw Value */
+#define MCU_GET_RESET_RAW_VALUE_SID          (uint8)0x06
+
+/* Service ID for MCU Perform Reset */
+#define MCU_PERFORM_RESET_SID                (uint8)0x07
+
+/* Service ID for MCU Set Mode */
+#define MCU_SET_MODE_SID                     (uint8)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called with wrong configuration pointer */
+#define MCU_E_PARAM_CONFIG                   (uint8)0x0A
+
+/* API service called with an invalid clock setting */
+#define MCU_E_PARAM_CLOCK                    (uint8)0x0B
+
+/* API service called with an invalid mode */
+#define MCU_E_PARAM_MODE                     (uint8)0x0C
+
+/* Mcu_DistributePllClock called while the PLL is not locked */
+#define MCU_E_PLL_NOT_LOCKED                 (uint8)0x0E
+
+/* API service called before Mcu_Init */
+#define MCU_E_UNINIT                         (uint8)0x0F
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the Id of a clock setting in Mcu_ConfigType */
+typedef uint8 Mcu_ClockType;
+
+/* Type definition for the lock status of the PLL */
+typedef enum
+{
+    MCU_PLL_LOCKED, MCU_PLL_UNLOCKED, MCU_PLL_STATUS_UNDEFINED
+}Mcu_PllStatusType;
+
+/* Type definition for the oscillator source of the system clock (OSCSRC2 field of RCC2) */
+typedef enum
+{
+    MCU_OSC_MAIN, MCU_OSC_PIOSC, MCU_OSC_PIOSC_DIV4, MCU_OSC_LFIOSC
+}Mcu_OscSourceType;
+
+/* Type definition for the cause of the last reset, decoded from the RESC register */
+typedef enum
+{
+    MCU_POWER_ON_RESET, MCU_BROWNOUT_RESET, MCU_EXTERNAL_RESET, MCU_WATCHDOG_RESET, MCU_SW_RESET,
+    MCU_OSC_FAILURE_RESET, MCU_RESET_UNDEFINED
+}Mcu_ResetType;
+
+/* Type definition for the RESC register value latched by Mcu_Init */
+typedef uint32 Mcu_RawResetType;
+
+/* Type definition for the Id of a mode setting in Mcu_ConfigType */
+typedef uint8 Mcu_ModeType;
+
+/* Type definition for the power mode entered by a mode setting */
+typedef enum
+{
+    MCU_POWER_RUN, MCU_POWER_SLEEP, MCU_POWER_DEEPSLEEP
+}Mcu_PowerModeType;
+
+/* Description: Structure of the peripherals kept clocked in a sleep mode (bit n --> module n):
+ *  written to the SCGC registers for the sleep mode and to the DCGC registers for the deep-sleep mode */
+typedef struct
+{
+    uint32 Gpio;
+    uint32 Timer;
+    uint32 WideTimer;
+    uint32 Uart;
+    uint32 Pwm;
+}Mcu_ClockGatingType;
+
+/* Description: Structure to configure a mode setting:
+ *  1. the power mode (run --> Mcu_SetMode returns at once)
+ *  2. the worst-case time from the wake-up event to the first instruction of its interrupt in us
+ *  3. the peripherals kept clocked during the mode (Timers used to wake up and measure the sleep)
+ *  4. the deep-sleep clock source, divider and resulting frequency (deep-sleep mode only), the mode is
+ *     only available when this frequency is the current system clock frequency so the SysTick
+ *     and the timers keep their rate while the core sleeps
+ */
+typedef struct
+{
+    Mcu_PowerModeType PowerMode;
+    uint32 WakeupLatency;
+    Mcu_ClockGatingType ClockGating;
+    Mcu_OscSourceType DeepSleepOsc;
+    uint8 DeepSleepDivider;
+    uint32 DeepSleepFrequency;
+}Mcu_ModeSettingConfigType;
+
+/* Type definition for the function notified after each change of the system clock frequency */
+typedef void (*Mcu_ClockNotificationType)(void);
+
+/* Description: Structure to configure a clock setting (clock profile):
+ *  1. the resulting system clock frequency in Hz, published by Mcu_GetSysClockFrequency
+ *  2. the oscillator source
+ *  3. the crystal connected to the main oscillator (XTAL field of RCC, 0x15 --> 16 MHz)
+ *  4. TRUE if the system clock is derived from the 400 MHz PLL, FALSE if it is derived from the oscillator
+ *  5. the system divider applied to the PLL or the oscillator (1 --> not divided)
+ */
+typedef struct
+{
+    uint32 Frequency;
+    Mcu_OscSourceType OscSource;
+    uint8 Xtal;
+    boolean UsePll;
+    uint8 SysDivider;
+}Mcu_ClockSettingConfigType;
+
+/* Data Structure required for initializing the Mcu Driver:
+ *  1. the clock settings selected by Mcu_InitClock
+ *  2. the mode settings selected by Mcu_SetMode
+ *  3. the functions notified after each change of the system clock frequency (timers rescaling)
+ */
+typedef struct Mcu_ConfigType
+{
+    Mcu_ClockSettingConfigType ClockSettings[MCU_NUMBER_OF_CLOCK_SETTINGS];
+    Mcu_ModeSettingConfigType ModeSettings[MCU_NUMBER_OF_MODES];
+    Mcu_ClockNotificationType ClockNotifications[MCU_NUMBER_OF_CLOCK_NOTIFICATIONS];
+}Mcu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for MCU Initialization API ... it latches and clears the reset cause then enables the clock of the GPIO Ports */
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr);
+
+/* Function for MCU Get Reset Reason API ... it decodes the reset cause latched by Mcu_Init */
+Mcu_ResetType Mcu_GetResetReason(void);
+
+/* Function for MCU Get Reset Raw Value API ... it returns the RESC register value latched by Mcu_Init */
+Mcu_RawResetType Mcu_GetResetRawValue(void);
+
+#if (MCU_PERFORM_RESET_API == STD_ON)
+/* Function for MCU Perform Reset API ... it requests a software reset of the whole device */
+void Mcu_PerformReset(void);
+#endif
+
+/* Function for MCU Init Clock API ... it switches to a clock setting without the PLL or starts the
+ * PLL of a clock setting using it, the PLL clock is then used after Mcu_DistributePllClock */
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting);
+
+/* Function for MCU Distribute Pll Clock API ... it switches the system clock to the locked PLL */
+Std_ReturnType Mcu_DistributePllClock(void);
+
+/* Function for MCU Get Pll Status API */
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/* Function for MCU Set Mode API ... it sleeps until the next interrupt, it is called with the interrupts
+ * disabled so an interrupt which happens just before still wakes it up */
+void Mcu_SetMode(Mcu_ModeType McuMode);
+
+/* Description: Return the wake-up latency in us of a mode, MCU_MODE_NOT_AVAILABLE if the mode can not be
+ *              used with the current system clock */
+uint32 Mcu_GetModeWakeupLatency(Mcu_ModeType McuMode);
+
+/* Description: Return the current system clock frequency in Hz, the drivers derive their timer reload
+ *              values from it, it is valid before Mcu_Init (reset clock) */
+uint32 Mcu_GetSysClockFrequency(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Mcu and other modules */
+extern const Mcu_ConfigType Mcu_Configuration;
 
 #endif /* MCU_H_ */
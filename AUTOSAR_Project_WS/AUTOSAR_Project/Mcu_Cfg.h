@@ -0,0 +1,52 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_CFG_SW_MAJOR_VERSION              (1U)
+#define MCU_CFG_SW_MINOR_VERSION              (0U)
+#define MCU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define MCU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for presence of Mcu_PerformReset API */
+#define MCU_PERFORM_RESET_API               (STD_ON)
+
+/* Number of the configured clock settings */
+#define MCU_NUMBER_OF_CLOCK_SETTINGS        (2U)
+
+/* Clock setting Index in the array of structures in Mcu_PBcfg.c */
+#define McuConf_CLOCK_HIGH_PERFORMANCE      (Mcu_ClockType)0x00   /* 80 MHz from the PLL */
+#define McuConf_CLOCK_LOW_POWER             (Mcu_ClockType)0x01   /* 4 MHz from the main oscillator, PLL off */
+
+/* Number of the configured modes */
+#define MCU_NUMBER_OF_MODES                 (2U)
+
+/* Mode Index in the array of structures in Mcu_PBcfg.c, ordered from the lightest to the deepest mode */
+#define McuConf_MODE_RUN                    (Mcu_ModeType)0x00
+#define McuConf_MODE_SLEEP                  (Mcu_ModeType)0x01
+
+/* Number of the functions notified after each change of the system clock frequency */
+#define MCU_NUMBER_OF_CLOCK_NOTIFICATIONS   (5U)
+
+#endif /* MCU_CFG_H */
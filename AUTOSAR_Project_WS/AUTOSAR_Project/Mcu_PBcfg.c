@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Mcu.h"
+#include "Gpt.h"
+#include "Os.h"
+#include "SwPwm.h"
+#include "Pwm.h"
+#include "Uart.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define MCU_PBCFG_SW_MINOR_VERSION              (0U)
+#define MCU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_PBCFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Mcu_Init API */
+const Mcu_ConfigType Mcu_Configuration = {
+                                             /* Clock settings --> Frequency, Oscillator, Crystal, PLL, System divider */
+                                             {
+                                                 {80000000UL, MCU_OSC_MAIN, 0x15, TRUE,  5},  /* 400 MHz PLL / 5 */
+                                                 {4000000UL,  MCU_OSC_MAIN, 0x15, FALSE, 4}   /* 16 MHz crystal / 4 */
+                                             },
+                                             /* Mode settings --> Power mode, Wake-up latency (us),
+                                              *                   Clocked {GPIO, Timer, Wide Timer, UART, PWM},
+                                              *                   Deep-sleep oscillator, divider and frequency
+                                              * Timer1 (Button debounce), Timer2 (SwPwm edges), UART0 (console) and PWM1 (LEDs)
+                                              * must run while the core sleeps.
+                                              * No deep-sleep mode: its clock must equal the system clock and the App always
+                                              * runs on the 80 MHz PLL, the PLL is off in deep-sleep */
+                                             {
+                                                 {MCU_POWER_RUN,       0,  {0x00, 0x00, 0x00, 0x00, 0x00}, MCU_OSC_MAIN,  1, 0},
+                                                 {MCU_POWER_SLEEP,     2,  {0x3F, 0x07, 0x20, 0x01, 0x02}, MCU_OSC_MAIN,  1, 0}
+                                             },
+                                             /* Clock change notifications --> timers rescaling */
+                                             {
+                                                 Gpt_ClockNotification,
+                                                 Os_ClockNotification,
+                                                 SwPwm_ClockNotification,
+                                                 Pwm_ClockNotification,
+                                                 Uart_ClockNotification
+                                             }
+                                         };
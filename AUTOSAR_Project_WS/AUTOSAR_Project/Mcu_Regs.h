@@ -0,0 +1,71 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver Registers fields
+ *              (the System Control registers are in tm4c123gh6pm_registers.h)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef MCU_REGS_H
+#define MCU_REGS_H
+
+/* Run-Mode Clock Configuration (RCC) fields */
+#define MCU_RCC_MOSCDIS_BIT               0         /* Main oscillator disable */
+#define MCU_RCC_XTAL_POS                  6         /* Crystal value (5 bits) */
+#define MCU_RCC_XTAL_MASK                 0x000007C0
+#define MCU_RCC_BYPASS_BIT                11        /* PLL bypass */
+#define MCU_RCC_USESYSDIV_BIT             22        /* Enable the system clock divider */
+#define MCU_RCC_ACG_BIT                   27        /* Sleep modes use the SCGC/DCGC registers instead of RCGC */
+
+/* Run-Mode Clock Configuration 2 (RCC2) fields, they override the RCC fields when USERCC2 is set */
+#define MCU_RCC2_OSCSRC2_POS              4         /* Oscillator source (3 bits) */
+#define MCU_RCC2_OSCSRC2_MASK             0x00000070
+#define MCU_RCC2_BYPASS2_BIT              11        /* PLL bypass */
+#define MCU_RCC2_PWRDN2_BIT               13        /* PLL power down */
+#define MCU_RCC2_SYSDIV2_POS              23        /* System clock divisor - 1 (6 bits) */
+#define MCU_RCC2_SYSDIV2LSB_POS           22        /* With DIV400 --> divisor - 1 of the 400 MHz PLL is 7 bits */
+#define MCU_RCC2_SYSDIV2_MASK             0x1FC00000
+#define MCU_RCC2_DIV400_BIT               30        /* Divide the 400 MHz PLL output instead of 200 MHz */
+#define MCU_RCC2_USERCC2_BIT              31        /* Use the RCC2 fields */
+
+/* Raw Interrupt Status (RIS) fields */
+#define MCU_RIS_PLLLRIS_BIT               6         /* PLL lock */
+#define MCU_RIS_MOSCPUPRIS_BIT            8         /* Main oscillator power up */
+
+/* Deep Sleep Clock Configuration (DSLPCLKCFG) fields */
+#define MCU_DSLPCLKCFG_DSOSCSRC_POS       4         /* Deep-sleep oscillator source (3 bits) */
+#define MCU_DSLPCLKCFG_DSOSCSRC_MASK      0x00000070
+#define MCU_DSLPCLKCFG_DSDIVORIDE_POS     23        /* Deep-sleep clock divisor - 1 (6 bits) */
+#define MCU_DSLPCLKCFG_DSDIVORIDE_MASK    0x1F800000
+
+/* Cortex-M4 System Control Register, SLEEPDEEP selects the deep-sleep mode on WFI */
+#define MCU_SCB_SCR_REG                   (*((volatile uint32 *)0xE000ED10))
+#define MCU_SCB_SCR_SLEEPDEEP_BIT         2
+
+/* Reset Cause (RESC) fields, they stay set until the register is written with 0 */
+#define MCU_RESC_EXT_BIT                  0         /* External reset pin */
+#define MCU_RESC_POR_BIT                  1         /* Power-on reset */
+#define MCU_RESC_BOR_BIT                  2         /* Brown-out reset */
+#define MCU_RESC_WDT0_BIT                 3         /* Watchdog timer 0 reset */
+#define MCU_RESC_SW_BIT                   4         /* Software reset */
+#define MCU_RESC_WDT1_BIT                 5         /* Watchdog timer 1 reset */
+#define MCU_RESC_MOSCFAIL_BIT             16        /* Main oscillator failure reset */
+
+/* Cortex-M4 Application Interrupt and Reset Control Register, SYSRESREQ resets the whole device */
+#define MCU_SCB_APINT_REG                 (*((volatile uint32 *)0xE000ED0C))
+#define MCU_SCB_APINT_VECTKEY             0x05FA0000
+#define MCU_SCB_APINT_SYSRESREQ_BIT       2
+
+/* PLL Status (PLLSTAT) fields */
+#define MCU_PLLSTAT_LOCK_BIT              0
+
+/* System divider range of the 400 MHz PLL (80 MHz maximum system clock, 7 bits) and of the oscillator (6 bits) */
+#define MCU_PLL_MIN_SYSDIV                5
+#define MCU_PLL_MAX_SYSDIV                128
+#define MCU_OSC_MAX_SYSDIV                64
+
+#endif /* MCU_REGS_H */
@@ -0,0 +1,71 @@
+ /******************************************************************************
+ *
+ * Module: NoInit
+ *
+ * File Name: NoInit.c
+ *
+ * Description: Source file for the records kept in the .noinit RAM section across the resets
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "NoInit.h"
+
+/************************************************************************************
+* Service Name: NoInit_Checksum
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Record - Address of the first word of the record
+*                  Words - Number of the words of the record, including the checksum
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Rotate-XOR checksum of the words before the last one
+* Description: Function to compute the checksum of a record, Tools/Fault_Decode computes
+*              the same checksum on the crash record.
+************************************************************************************/
+uint32 NoInit_Checksum(const uint32 * Record, uint32 Words)
+{
+	uint32 sum = 0;
+	uint32 index;
+
+	for(index = 0; index < (Words - 1U); index++)
+	{
+		sum = ((sum << 1) | (sum >> 31)) ^ Record[index];
+	}
+	return ~sum;
+}
+
+/************************************************************************************
+* Service Name: NoInit_IsValid
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Record - Address of the first word of the record
+*                  Words - Number of the words of the record, including the checksum
+*                  Signature - Signature of the owner module
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the record was sealed with Signature and not changed since
+* Description: Function to check a record before it is read after a reset.
+************************************************************************************/
+boolean NoInit_IsValid(const uint32 * Record, uint32 Words, uint32 Signature)
+{
+	return (boolean)((Signature == Record[0]) && (NoInit_Checksum(Record, Words) == Record[Words - 1U]));
+}
+
+/************************************************************************************
+* Service Name: NoInit_Seal
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Words - Number of the words of the record, including the checksum
+*                  Signature - Signature of the owner module
+* Parameters (inout): Record - Address of the first word of the record
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the signature and the checksum of a record once its data
+*              is written. The caller protects the record from the preempting writers.
+************************************************************************************/
+void NoInit_Seal(uint32 * Record, uint32 Words, uint32 Signature)
+{
+	Record[0] = Signature;
+	Record[Words - 1U] = NoInit_Checksum(Record, Words);
+}
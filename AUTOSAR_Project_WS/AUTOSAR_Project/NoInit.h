@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: NoInit
+ *
+ * File Name: NoInit.h
+ *
+ * Description: Header file for the records kept in the .noinit RAM section across the
+ *              software, watchdog and fault resets (Dio, Pwm and Fault records)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef NOINIT_H
+#define NOINIT_H
+
+#include "Std_Types.h"
+
+/*
+ * A record is a structure placed in the .noinit section with #pragma DATA_SECTION, the C startup
+ * does not clear it. It is read as an array of 32-bit words:
+ *  1. the first word holds the signature of the owner module once the record is written
+ *  2. the last word holds the checksum of the words before it, a write interrupted by a reset
+ *     or the random content after a power-on leaves it invalid
+ * The padding bytes of the structure are covered too, they are never written so they keep their value.
+ */
+
+/* Number of the words of a record, the structure size is a multiple of the word size */
+#define NOINIT_RECORD_WORDS(Record)      (sizeof(Record) / sizeof(uint32))
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to compute the checksum of the words before the last word of a record */
+uint32 NoInit_Checksum(const uint32 * Record, uint32 Words);
+
+/* Function to check the signature and the checksum of a record */
+boolean NoInit_IsValid(const uint32 * Record, uint32 Words, uint32 Signature);
+
+/* Function to write the signature and the checksum of a record after its data */
+void NoInit_Seal(uint32 * Record, uint32 Words, uint32 Signature);
+
+#endif /* NOINIT_H */
@@ -14,6 +14,12 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Mcu.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
 
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
@@ -21,35 +27,644 @@
 /* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
 #define Disable_Exceptions()   __asm(" CPSID I ")
 
+/* Disable Exceptions and return the previous PRIMASK ... TI compiler intrinsic, the compiler keeps the
+ * MRS/CPSID pair and the returned value consistent with the code around it. */
+#define Disable_Exceptions_Save_Primask()  ((uint32)_disable_IRQ())
+
 /* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
 #define Enable_Faults()        __asm(" CPSIE F ")
 
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Task Id used for the idle portion of the Os Scheduler (lower priority than all the tasks) */
+#define OS_IDLE_TASK                    ((TaskType)OS_NUMBER_OF_TASKS)
+
+/* Mask of the tasks with a higher priority (lower Id) than the given task */
+#define OS_HIGHER_PRIORITY_MASK(TASK)   (((TASK) >= 32U) ? 0xFFFFFFFFUL : (OS_TASK_MASK(TASK) - 1UL))
+
+/* PendSV is used to run the preemptive tasks, it has the lowest priority to run after all the interrupts */
+#define OS_PENDSV_SET_MASK              0x10000000
+#define OS_PENDSV_PRIORITY_MASK         0xFF1FFFFF
+#define OS_PENDSV_INTERRUPT_PRIORITY    7
+#define OS_PENDSV_PRIORITY_BITS_POS     21
+
+/* Priority of the Os tick among the SysTick subscribers (0 --> called first) */
+#define OS_SYSTICK_PRIORITY             0
+
+/* Each schedule table is driven by an internal alarm placed after the configured alarms */
+#define OS_NUMBER_OF_TIMERS             (OS_NUMBER_OF_ALARMS + OS_NUMBER_OF_SCHEDULE_TABLES)
+#define OS_SCHTBL_ALARM(SCHTBL)         ((AlarmType)(OS_NUMBER_OF_ALARMS + (SCHTBL)))
+
+/* Value stored in the heap position of an alarm which is not running */
+#define OS_ALARM_NOT_RUNNING   (0xFFFFU)
+
+/* Check if the expiry of alarm A comes before the expiry of alarm B (the internal ticks may wrap) */
+#define OS_ALARM_EXPIRES_BEFORE(A,B)  ((sint32)(g_Alarm_Expiry[A] - g_Alarm_Expiry[B]) < 0)
+
+#if ((OS_IDLE_SLEEP == STD_ON) && (GPT_TIMESTAMP_API != STD_ON))
+  #error "OS_IDLE_SLEEP needs the Gpt timestamp to count the time slept as idle"
+#endif
 
 /* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+static volatile uint8 g_New_Time_Tick_Flag = 0;
+
+/* Free running counter incremented by the idle portion of the Os Scheduler */
+static volatile uint32 g_Idle_Count = 0;
+
+/* Value of the idle counter captured by the timer tick */
+static volatile uint32 g_Idle_Count_Snapshot = 0;
+
+/* Value of the idle counter snapshot used by the previous load computation */
+static uint32 g_Idle_Count_Previous = 0;
+
+/* Number of idle loop iterations in one Os tick when no task is running, measured at startup */
+static uint32 g_Idle_Calibration = 0;
+
+/* System clock frequency the idle calibration corresponds to */
+static uint32 g_Idle_Calibration_Clock = 0;
+
+/* Loads of the last second of Os ticks used to compute the rolling average */
+static uint8 g_Cpu_Load_History[OS_CPU_LOAD_WINDOW_TICKS];
+static uint8 g_Cpu_Load_History_Index = 0;
+static uint16 g_Cpu_Load_Sum = 0;
+
+/* Core cycles from the reset handler to Os_start returned by Os_GetStartupCycles */
+static uint32 g_Startup_Cycles = 0;
+
+/* Measured cpu load returned by Os_GetCpuLoad */
+static Os_CpuLoadType g_Cpu_Load = {0, 0, 0};
+
+/* Bit mask of the activated tasks ... bit n is set when task n is ready */
+static volatile uint32 g_Ready_Tasks = 0;
+
+/* Size, high-water mark (lowest used word) and next scanned word + 1 of each stack in words from its bottom */
+static uint32 g_Stack_Size[OS_NUMBER_OF_STACKS];
+static uint32 g_Stack_High_Water[OS_NUMBER_OF_STACKS];
+static uint32 g_Stack_Scan_Index[OS_NUMBER_OF_STACKS];
+static boolean g_Stack_Guard_Reported[OS_NUMBER_OF_STACKS];
+
+/* Stack scanned by the idle passes of the Os Scheduler */
+static uint8 g_Stack_Scan_Id = 0;
+
+/* Task being executed, OS_IDLE_TASK when no task is running */
+static volatile TaskType g_Running_Task = OS_IDLE_TASK;
+
+/* Bit mask of the tasks configured as preemptive */
+static uint32 g_Preemptive_Tasks = 0;
+
+/* Nesting level and saved PRIMASK of SuspendAllInterrupts/ResumeAllInterrupts */
+static uint8 g_Suspend_Nesting = 0;
+static uint32 g_Suspend_Saved_Primask = 0;
+
+/* Visible value of each counter, it wraps to zero after maxallowedvalue */
+static TickType g_Counter_Value[OS_NUMBER_OF_COUNTERS];
+
+/* Free running number of ticks of each counter used to order the alarms */
+static TickType g_Counter_Ticks[OS_NUMBER_OF_COUNTERS];
+
+/* Min-heap of the running alarms of each counter ordered by expiry, the next expiry is at index 0 */
+static AlarmType g_Counter_Heap[OS_NUMBER_OF_COUNTERS][OS_NUMBER_OF_TIMERS];
+static AlarmType g_Counter_Heap_Size[OS_NUMBER_OF_COUNTERS];
+
+/* Expiry in counter ticks, cycle and heap position of each alarm (including the schedule table alarms) */
+static TickType g_Alarm_Expiry[OS_NUMBER_OF_TIMERS];
+static TickType g_Alarm_Cycle[OS_NUMBER_OF_TIMERS];
+static AlarmType g_Alarm_Heap_Position[OS_NUMBER_OF_TIMERS];
+
+/* State and index of the next expiry point of each schedule table (NumberOfExpiryPoints for the final delay) */
+static ScheduleTableStatusType g_SchTbl_Status[OS_NUMBER_OF_SCHEDULE_TABLES];
+static uint8 g_SchTbl_Next_Point[OS_NUMBER_OF_SCHEDULE_TABLES];
+
+/*********************************************************************************************/
+/* Description: Check the first guard word of the stack reached by an overflow and report once
+ *              to Det when the stack is used down to its guard zone */
+static void Os_CheckStackGuard(uint8 StackID)
+{
+    if(Os_StackConfig[StackID].Bottom[OS_STACK_GUARD_WORDS - 1] != OS_STACK_PAINT_PATTERN)
+    {
+        if(g_Stack_High_Water[StackID] > (OS_STACK_GUARD_WORDS - 1))
+        {
+            g_Stack_High_Water[StackID] = OS_STACK_GUARD_WORDS - 1;
+        }
+    }
+
+    if((g_Stack_High_Water[StackID] < OS_STACK_GUARD_WORDS) && (g_Stack_Guard_Reported[StackID] == FALSE))
+    {
+        g_Stack_Guard_Reported[StackID] = TRUE;
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+        /* The Instance Id is used to report the Stack Id */
+        Det_ReportError(OS_MODULE_ID, StackID, OS_STACK_MONITOR_SID, OS_E_STACK_GUARD);
+#endif
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Check OS_STACK_SCAN_WORDS words of the stack below its high-water mark, the scan goes down
+ *              to the stack bottom then starts again from the high-water mark of the next stack */
+static void Os_StackScan(void)
+{
+    uint8 id = g_Stack_Scan_Id;
+    const uint32 * bottom = Os_StackConfig[id].Bottom;
+    uint32 index = g_Stack_Scan_Index[id];
+    uint8 count;
+
+    for(count = 0; count < OS_STACK_SCAN_WORDS; count++)
+    {
+        if(index == 0)
+        {
+            g_Stack_Scan_Index[id] = g_Stack_High_Water[id];
+            Os_CheckStackGuard(id);
+            g_Stack_Scan_Id = (uint8)((id + 1) % OS_NUMBER_OF_STACKS);
+            return;
+        }
+
+        index--;
+        if((bottom[index] != OS_STACK_PAINT_PATTERN) && (index < g_Stack_High_Water[id]))
+        {
+            g_Stack_High_Water[id] = index;
+        }
+    }
+    g_Stack_Scan_Index[id] = index;
+}
+
+/*********************************************************************************************/
+/* Description: Count the idle loop iterations of one full Os tick while no task is running */
+static void Os_CalibrateIdleLoop(void)
+{
+    uint32 start_count;
+
+    /* Wait for the next tick to start the measurement on a tick boundary */
+    g_New_Time_Tick_Flag = 0;
+    while(g_New_Time_Tick_Flag == 0);
+
+    g_New_Time_Tick_Flag = 0;
+    start_count = g_Idle_Count;
+
+    /* Same loop body as the idle portion of the Os Scheduler */
+    while(g_New_Time_Tick_Flag == 0)
+    {
+        if(g_Ready_Tasks == 0)
+        {
+            g_Idle_Count++;
+            Os_StackScan();
+        }
+    }
+
+    g_Idle_Calibration    = g_Idle_Count_Snapshot - start_count;
+    g_Idle_Calibration_Clock = Mcu_GetSysClockFrequency();
+    g_Idle_Count_Previous = g_Idle_Count_Snapshot;
+    g_New_Time_Tick_Flag  = 0;
+}
+
+#if (OS_IDLE_SLEEP == STD_ON)
+/*********************************************************************************************/
+/* Description: Time in us until the next alarm or schedule table expiry of the system counter,
+ *              0xFFFFFFFF if none is running (the interrupts are disabled by the caller) */
+static uint32 Os_TimeToNextRelease(void)
+{
+    uint32 time = 0xFFFFFFFFUL;
+    TickType ticks;
+
+    if(g_Counter_Heap_Size[OS_COUNTER_SYSTEM] > 0)
+    {
+        ticks = g_Alarm_Expiry[g_Counter_Heap[OS_COUNTER_SYSTEM][0]] - g_Counter_Ticks[OS_COUNTER_SYSTEM];
+        if(ticks == 0)
+        {
+            time = 0;
+        }
+        else if(ticks < (0xFFFFFFFFUL / (OS_BASE_TIME * 1000UL)))
+        {
+            /* The alarm expires at the end of the tick number "ticks" from now */
+            time = SysTick_GetTimeToNextTick() + ((ticks - 1) * (OS_BASE_TIME * 1000UL));
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return time;
+}
+
+/*********************************************************************************************/
+/* Description: Enter the deepest Mcu mode whose wake-up latency fits before the next task release,
+ *              the time slept is added to the idle count as if the idle loop ran during it */
+static void Os_IdleSleep(void)
+{
+    Mcu_ModeType mode = (Mcu_ModeType)(MCU_NUMBER_OF_MODES - 1);
+    uint32 time_to_release;
+    Gpt_TimestampType sleep_start;
+    uint32 slept;
+
+    /* An activation between the ready check and the WFI would wait for the next interrupt,
+     * with the interrupts disabled the pending interrupt wakes the core and runs after the resume */
+    SuspendAllInterrupts();
+
+    if(g_Ready_Tasks == 0)
+    {
+        time_to_release = Os_TimeToNextRelease();
+        while((mode > McuConf_MODE_RUN) && (Mcu_GetModeWakeupLatency(mode) > time_to_release))
+        {
+            mode--;
+        }
+
+        if(mode != McuConf_MODE_RUN)
+        {
+            sleep_start = Gpt_GetTimestamp();
+            Mcu_SetMode(mode);
+            slept = (uint32)(Gpt_GetTimestamp() - sleep_start);
+
+            /* Counted before the waking interrupt snapshots the idle count of the tick */
+            g_Idle_Count += (uint32)(((uint64)slept * g_Idle_Calibration) / (OS_BASE_TIME * 1000UL));
+        }
+    }
+
+    ResumeAllInterrupts();
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Called every new tick to compute the load of the previous tick from the idle count */
+static void Os_UpdateCpuLoad(void)
+{
+    uint32 snapshot = g_Idle_Count_Snapshot;
+    uint32 idle     = snapshot - g_Idle_Count_Previous;
+    uint8 load;
+
+    g_Idle_Count_Previous = snapshot;
+
+    if((g_Idle_Calibration == 0) || (idle >= g_Idle_Calibration))
+    {
+        load = 0;
+    }
+    else
+    {
+        load = (uint8)(100 - ((idle * 100) / g_Idle_Calibration));
+    }
+
+    /* Replace the oldest tick load in the rolling window of one second */
+    g_Cpu_Load_Sum -= g_Cpu_Load_History[g_Cpu_Load_History_Index];
+    g_Cpu_Load_Sum += load;
+    g_Cpu_Load_History[g_Cpu_Load_History_Index] = load;
+    g_Cpu_Load_History_Index++;
+    if(g_Cpu_Load_History_Index == OS_CPU_LOAD_WINDOW_TICKS)
+    {
+        g_Cpu_Load_History_Index = 0;
+    }
+
+    g_Cpu_Load.TickLoad    = load;
+    g_Cpu_Load.AverageLoad = (uint8)(g_Cpu_Load_Sum / OS_CPU_LOAD_WINDOW_TICKS);
+    if(load > g_Cpu_Load.PeakLoad)
+    {
+        g_Cpu_Load.PeakLoad = load;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Move the alarm at the given heap index up until its parent expires before it */
+static void Os_HeapSiftUp(CounterType CounterID, AlarmType Index)
+{
+    AlarmType * heap = g_Counter_Heap[CounterID];
+    AlarmType alarm  = heap[Index];
+    AlarmType parent;
+
+    while(Index > 0)
+    {
+        parent = (AlarmType)((Index - 1) / 2);
+        if(!OS_ALARM_EXPIRES_BEFORE(alarm, heap[parent]))
+        {
+            break;
+        }
+        heap[Index] = heap[parent];
+        g_Alarm_Heap_Position[heap[Index]] = Index;
+        Index = parent;
+    }
+    heap[Index] = alarm;
+    g_Alarm_Heap_Position[alarm] = Index;
+}
+
+/*********************************************************************************************/
+/* Description: Move the alarm at the given heap index down until both children expire after it */
+static void Os_HeapSiftDown(CounterType CounterID, AlarmType Index)
+{
+    AlarmType * heap = g_Counter_Heap[CounterID];
+    AlarmType size   = g_Counter_Heap_Size[CounterID];
+    AlarmType alarm  = heap[Index];
+    AlarmType child;
+
+    while(((2 * Index) + 1) < size)
+    {
+        child = (AlarmType)((2 * Index) + 1);
+        if(((child + 1) < size) && OS_ALARM_EXPIRES_BEFORE(heap[child + 1], heap[child]))
+        {
+            child++;
+        }
+        if(!OS_ALARM_EXPIRES_BEFORE(heap[child], alarm))
+        {
+            break;
+        }
+        heap[Index] = heap[child];
+        g_Alarm_Heap_Position[heap[Index]] = Index;
+        Index = child;
+    }
+    heap[Index] = alarm;
+    g_Alarm_Heap_Position[alarm] = Index;
+}
+
+/*********************************************************************************************/
+/* Description: Add the alarm to the heap of its counter */
+static void Os_HeapInsert(CounterType CounterID, AlarmType AlarmID)
+{
+    AlarmType index = g_Counter_Heap_Size[CounterID];
+
+    g_Counter_Heap[CounterID][index] = AlarmID;
+    g_Counter_Heap_Size[CounterID]++;
+    Os_HeapSiftUp(CounterID, index);
+}
+
+/*********************************************************************************************/
+/* Description: Remove the alarm from the heap of its counter */
+static void Os_HeapRemove(CounterType CounterID, AlarmType AlarmID)
+{
+    AlarmType * heap = g_Counter_Heap[CounterID];
+    AlarmType index  = g_Alarm_Heap_Position[AlarmID];
+    AlarmType last;
+
+    g_Alarm_Heap_Position[AlarmID] = OS_ALARM_NOT_RUNNING;
+    g_Counter_Heap_Size[CounterID]--;
+    last = g_Counter_Heap_Size[CounterID];
+
+    /* Fill the hole with the last alarm of the heap and restore the heap order */
+    if(index != last)
+    {
+        heap[index] = heap[last];
+        g_Alarm_Heap_Position[heap[index]] = index;
+        if((index > 0) && OS_ALARM_EXPIRES_BEFORE(heap[index], heap[(index - 1) / 2]))
+        {
+            Os_HeapSiftUp(CounterID, index);
+        }
+        else
+        {
+            Os_HeapSiftDown(CounterID, index);
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Clear and return the ready task with the highest priority among the mask,
+ *              OS_IDLE_TASK if none is ready ... called with the interrupts suspended */
+static TaskType Os_TakeReadyTask(uint32 Mask)
+{
+    uint32 ready = g_Ready_Tasks & Mask;
+    TaskType task = 0;
+
+    if(ready == 0)
+    {
+        return OS_IDLE_TASK;
+    }
+
+    while((ready & 1U) == 0)
+    {
+        ready >>= 1;
+        task++;
+    }
+    g_Ready_Tasks &= ~OS_TASK_MASK(task);
+    return task;
+}
+
+/*********************************************************************************************/
+/* Description: Request PendSV if a ready preemptive task has a higher priority than the running task */
+static void Os_CheckPreemption(void)
+{
+#if (OS_PREEMPTION == STD_ON)
+    if((g_Ready_Tasks & g_Preemptive_Tasks & OS_HIGHER_PRIORITY_MASK(g_Running_Task)) != 0)
+    {
+        NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    }
+#endif
+}
+
+/*********************************************************************************************/
+/* Description: Process the expiry points of the schedule table due now and insert its alarm for the next one */
+static void Os_ScheduleTableExpiry(ScheduleTableType ScheduleTableID)
+{
+    const Os_ScheduleTableConfigType * table = &Os_ScheduleTableConfig[ScheduleTableID];
+    uint8 point = g_SchTbl_Next_Point[ScheduleTableID];
+    TickType now_offset;
+    TickType next_offset;
+
+    /* Expiry points at the same offset as the end of the previous round are processed now */
+    do
+    {
+        if(point == table->NumberOfExpiryPoints)
+        {
+            /* End of the final delay ... a repeating table starts again from its first expiry point */
+            if(table->Repeating == FALSE)
+            {
+                g_SchTbl_Status[ScheduleTableID] = SCHEDULETABLE_STOPPED;
+                return;
+            }
+            point = 0;
+            now_offset = 0;
+        }
+        else
+        {
+            /* A task which is still ready is not activated twice, same as ActivateTask */
+            g_Ready_Tasks |= table->ExpiryPoints[point].TaskMask;
+            Os_CheckPreemption();
+            now_offset = table->ExpiryPoints[point].Offset;
+            point++;
+        }
+
+        if(point == table->NumberOfExpiryPoints)
+        {
+            next_offset = table->Duration;
+        }
+        else
+        {
+            next_offset = table->ExpiryPoints[point].Offset;
+        }
+    }while(next_offset == now_offset);
+
+    g_SchTbl_Next_Point[ScheduleTableID] = point;
+    g_Alarm_Expiry[OS_SCHTBL_ALARM(ScheduleTableID)] += next_offset - now_offset;
+    Os_HeapInsert(table->Counter, OS_SCHTBL_ALARM(ScheduleTableID));
+}
+
+/*********************************************************************************************/
+/* Description: Increment the counter and process only the alarms which expired at the new value */
+static void Os_CounterTick(CounterType CounterID)
+{
+    AlarmType alarm;
+
+    g_Counter_Ticks[CounterID]++;
+    if(g_Counter_Value[CounterID] >= Os_CounterConfig[CounterID].maxallowedvalue)
+    {
+        g_Counter_Value[CounterID] = 0;
+    }
+    else
+    {
+        g_Counter_Value[CounterID]++;
+    }
+
+    while((g_Counter_Heap_Size[CounterID] > 0)
+       && ((sint32)(g_Alarm_Expiry[g_Counter_Heap[CounterID][0]] - g_Counter_Ticks[CounterID]) <= 0))
+    {
+        alarm = g_Counter_Heap[CounterID][0];
+        Os_HeapRemove(CounterID, alarm);
+
+        /* Cyclic alarms are inserted again with their next expiry */
+        if(g_Alarm_Cycle[alarm] != 0)
+        {
+            g_Alarm_Expiry[alarm] += g_Alarm_Cycle[alarm];
+            Os_HeapInsert(CounterID, alarm);
+        }
+
+        if(alarm >= OS_NUMBER_OF_ALARMS)
+        {
+            Os_ScheduleTableExpiry((ScheduleTableType)(alarm - OS_NUMBER_OF_ALARMS));
+        }
+        else if(Os_AlarmConfig[alarm].Action == OS_ALARM_ACTION_ACTIVATETASK)
+        {
+            (void)ActivateTask(Os_AlarmConfig[alarm].Task);
+        }
+        else if(Os_AlarmConfig[alarm].Callback != NULL_PTR)
+        {
+            (*Os_AlarmConfig[alarm].Callback)();
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Check the alarm arguments then insert the alarm to expire after delta ticks */
+static StatusType Os_StartAlarm(AlarmType AlarmID, TickType delta, TickType cycle)
+{
+    StatusType status = E_OK;
+    CounterType counter = Os_AlarmConfig[AlarmID].Counter;
+
+    if((cycle != 0) && ((cycle < Os_CounterConfig[counter].mincycle) || (cycle > Os_CounterConfig[counter].maxallowedvalue)))
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        if(g_Alarm_Heap_Position[AlarmID] != OS_ALARM_NOT_RUNNING)
+        {
+            status = E_OS_STATE;
+        }
+        else
+        {
+            g_Alarm_Expiry[AlarmID] = g_Counter_Ticks[counter] + delta;
+            g_Alarm_Cycle[AlarmID]  = cycle;
+            Os_HeapInsert(counter, AlarmID);
+        }
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+/* Description: Start the schedule table alarm to process the first expiry point after delta ticks */
+static StatusType Os_StartScheduleTable(ScheduleTableType ScheduleTableID, TickType delta)
+{
+    StatusType status = E_OK;
+    const Os_ScheduleTableConfigType * table = &Os_ScheduleTableConfig[ScheduleTableID];
+
+    SuspendAllInterrupts();
+    if(g_SchTbl_Status[ScheduleTableID] != SCHEDULETABLE_STOPPED)
+    {
+        status = E_OS_STATE;
+    }
+    else
+    {
+        g_SchTbl_Status[ScheduleTableID]     = SCHEDULETABLE_RUNNING;
+        g_SchTbl_Next_Point[ScheduleTableID] = 0;
+        g_Alarm_Expiry[OS_SCHTBL_ALARM(ScheduleTableID)] = g_Counter_Ticks[table->Counter] + delta + table->ExpiryPoints[0].Offset;
+        g_Alarm_Cycle[OS_SCHTBL_ALARM(ScheduleTableID)]  = 0;
+        Os_HeapInsert(table->Counter, OS_SCHTBL_ALARM(ScheduleTableID));
+    }
+    ResumeAllInterrupts();
+    return status;
+}
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+    AlarmType alarm;
+    ScheduleTableType table;
+    TaskType task;
+    uint8 stack;
+
+    /* Time to main, main calls Os_start first */
+    g_Startup_Cycles = DWT_CYCCNT_REG;
+
+    /* The stacks are painted at reset, their scan starts from the top */
+    for(stack = 0; stack < OS_NUMBER_OF_STACKS; stack++)
+    {
+        g_Stack_Size[stack]           = (uint32)(Os_StackConfig[stack].Top - Os_StackConfig[stack].Bottom);
+        g_Stack_High_Water[stack]     = g_Stack_Size[stack];
+        g_Stack_Scan_Index[stack]     = g_Stack_Size[stack];
+        g_Stack_Guard_Reported[stack] = FALSE;
+    }
+
+    for(task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        if(Os_TaskConfig[task].Preemptive == TRUE)
+        {
+            g_Preemptive_Tasks |= OS_TASK_MASK(task);
+        }
+    }
+
+#if (OS_PREEMPTION == STD_ON)
+    /* Assign the lowest priority to PendSV so the preemptive tasks run after the interrupt which activated them */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_INTERRUPT_PRIORITY << OS_PENDSV_PRIORITY_BITS_POS);
+#endif
+
+    /* No alarm is running at startup */
+    for(alarm = 0; alarm < OS_NUMBER_OF_TIMERS; alarm++)
+    {
+        g_Alarm_Heap_Position[alarm] = OS_ALARM_NOT_RUNNING;
+    }
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
-    
-    /* 
-     * Set the Call Back function to call Os_NewTimerTick
-     * this function will be called every SysTick Interrupt (20ms)
+
+    /*
+     * Subscribe Os_NewTimerTick to the SysTick Timer before the other modules,
+     * this function will be called first every SysTick Interrupt (20ms)
      */
-    SysTick_SetCallBack(Os_NewTimerTick);
+    (void)SysTick_Subscribe(Os_NewTimerTick, 1, OS_SYSTICK_PRIORITY);
+
+    /* Execute the Init Task ... the modules subscribe to the SysTick Timer and Mcu sets the system clock */
+    Init_Task();
 
     /* Start SysTickTimer to generate interrupt every 20ms */
     SysTick_Start(OS_BASE_TIME);
 
-    /* Execute the Init Task */
-    Init_Task();
+    /* Measure the idle loop speed used as the reference for the cpu load */
+    Os_CalibrateIdleLoop();
+
+#if (OS_NUMBER_OF_AUTOSTART_ALARMS > 0U)
+    /* Start the autostart alarms */
+    for(alarm = 0; alarm < OS_NUMBER_OF_AUTOSTART_ALARMS; alarm++)
+    {
+        (void)SetRelAlarm(Os_AlarmAutostart[alarm].Alarm, Os_AlarmAutostart[alarm].Increment, Os_AlarmAutostart[alarm].Cycle);
+    }
+#endif
+
+    /* Start the schedule tables which activate the periodic tasks */
+    for(table = 0; table < OS_NUMBER_OF_SCHEDULE_TABLES; table++)
+    {
+        if(Os_ScheduleTableConfig[table].AutostartOffset != 0)
+        {
+            (void)StartScheduleTableRel(table, Os_ScheduleTableConfig[table].AutostartOffset);
+        }
+    }
 
     /* Start the Os Scheduler */
     Os_Scheduler();
@@ -58,49 +673,469 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    /* Increment the system counter and process the expired alarms */
+    SuspendAllInterrupts();
+    Os_CounterTick(OS_COUNTER_SYSTEM);
+    ResumeAllInterrupts();
+
+    /* Capture the idle count of the tick that just finished */
+    g_Idle_Count_Snapshot = g_Idle_Count;
 
     /* Set the flag to 1 to indicate that there is a new timer tick */
     g_New_Time_Tick_Flag = 1;
 }
 
+/*********************************************************************************************/
+void Os_ClockNotification(void)
+{
+    uint32 clock = Mcu_GetSysClockFrequency();
+
+    /* The idle loop runs proportionally faster or slower, rescale its reference instead of
+     * measuring it again (the flash prefetch makes it approximate at high frequencies) */
+    if((g_Idle_Calibration != 0) && (g_Idle_Calibration_Clock != 0))
+    {
+        g_Idle_Calibration = (uint32)(((uint64)g_Idle_Calibration * clock) / g_Idle_Calibration_Clock);
+        g_Idle_Calibration_Clock = clock;
+    }
+}
+
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+    TaskType task;
+    uint8 stack;
+
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
+	/* Update the cpu load once per timer tick */
 	if(g_New_Time_Tick_Flag == 1)
 	{
-	    switch(g_Time_Tick_Count)
+	    g_New_Time_Tick_Flag = 0;
+	    Os_UpdateCpuLoad();
+
+	    /* Detect a stack reaching its guard zone within one tick even if the scan is elsewhere */
+	    for(stack = 0; stack < OS_NUMBER_OF_STACKS; stack++)
+	    {
+	        Os_CheckStackGuard(stack);
+	    }
+	}
+
+	if(g_Ready_Tasks != 0)
+	{
+	    /* Dispatch the ready task with the lowest Id (highest priority), it may have been run by PendSV meanwhile */
+	    SuspendAllInterrupts();
+	    task = Os_TakeReadyTask(0xFFFFFFFFUL);
+	    g_Running_Task = task;
+	    ResumeAllInterrupts();
+
+	    if(task != OS_IDLE_TASK)
+	    {
+	        (*Os_TaskConfig[task].Entry)();
+	        g_Running_Task = OS_IDLE_TASK;
+	    }
+	}
+	else
+	{
+	    /* No task is ready ... count the idle loop iterations for the cpu load measurement */
+	    g_Idle_Count++;
+
+	    /* Continue the search of the stacks high-water marks */
+	    Os_StackScan();
+
+#if (OS_IDLE_SLEEP == STD_ON)
+	    /* Sleep until the next interrupt if the next task release is far enough */
+	    Os_IdleSleep();
+#endif
+	}
+    }
+
+}
+
+#if (OS_PREEMPTION == STD_ON)
+/*********************************************************************************************/
+void PendSV_Handler(void)
+{
+    TaskType preempted = g_Running_Task;
+    TaskType task;
+
+    /* Run the ready preemptive tasks with a higher priority than the preempted one, the tasks
+     * share the main stack and run to completion so the preempted task continues after them */
+    SuspendAllInterrupts();
+    task = Os_TakeReadyTask(g_Preemptive_Tasks & OS_HIGHER_PRIORITY_MASK(preempted));
+    while(task != OS_IDLE_TASK)
+    {
+        g_Running_Task = task;
+        ResumeAllInterrupts();
+
+        (*Os_TaskConfig[task].Entry)();
+
+        SuspendAllInterrupts();
+        task = Os_TakeReadyTask(g_Preemptive_Tasks & OS_HIGHER_PRIORITY_MASK(preempted));
+    }
+    g_Running_Task = preempted;
+    ResumeAllInterrupts();
+}
+#endif
+
+/*********************************************************************************************/
+void Os_GetCpuLoad(Os_CpuLoadType * CpuLoad)
+{
+    if(CpuLoad != NULL_PTR)
+    {
+        *CpuLoad = g_Cpu_Load;
+    }
+}
+
+/*********************************************************************************************/
+uint32 Os_GetStartupCycles(void)
+{
+    return g_Startup_Cycles;
+}
+
+/*********************************************************************************************/
+StatusType Os_GetStackUsage(uint8 StackID, Os_StackUsageType * Usage)
+{
+    StatusType status = E_OK;
+
+    if(StackID >= OS_NUMBER_OF_STACKS)
+    {
+        status = E_OS_ID;
+    }
+    else if(Usage == NULL_PTR)
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        Usage->Size    = g_Stack_Size[StackID] * sizeof(uint32);
+        Usage->MaxUsed = (g_Stack_Size[StackID] - g_Stack_High_Water[StackID]) * sizeof(uint32);
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType ActivateTask(TaskType TaskID)
+{
+    StatusType status = E_OK;
+
+    if(TaskID >= OS_NUMBER_OF_TASKS)
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        if((g_Ready_Tasks & OS_TASK_MASK(TaskID)) != 0)
+        {
+            /* Only one activation of a basic task can be recorded */
+            status = E_OS_LIMIT;
+        }
+        else
+        {
+            g_Ready_Tasks |= OS_TASK_MASK(TaskID);
+            Os_CheckPreemption();
+        }
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+void SuspendAllInterrupts(void)
+{
+    uint32 primask = Disable_Exceptions_Save_Primask();
+
+    if(g_Suspend_Nesting == 0)
+    {
+        g_Suspend_Saved_Primask = primask;
+    }
+    g_Suspend_Nesting++;
+}
+
+/*********************************************************************************************/
+void ResumeAllInterrupts(void)
+{
+    if(g_Suspend_Nesting > 0)
+    {
+        g_Suspend_Nesting--;
+        if((g_Suspend_Nesting == 0) && (g_Suspend_Saved_Primask == 0))
+        {
+            Enable_Exceptions();
+        }
+    }
+}
+
+/*********************************************************************************************/
+StatusType IncrementCounter(CounterType CounterID)
+{
+    StatusType status = E_OK;
+
+    /* The system counter is only driven by the Os timer */
+    if((CounterID >= OS_NUMBER_OF_COUNTERS) || (CounterID == OS_COUNTER_SYSTEM))
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        Os_CounterTick(CounterID);
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType GetCounterValue(CounterType CounterID, TickRefType Value)
+{
+    StatusType status = E_OK;
+
+    if(CounterID >= OS_NUMBER_OF_COUNTERS)
+    {
+        status = E_OS_ID;
+    }
+    else if(Value == NULL_PTR)
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        *Value = g_Counter_Value[CounterID];
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType GetAlarmBase(AlarmType AlarmID, AlarmBaseRefType Info)
+{
+    StatusType status = E_OK;
+
+    if(AlarmID >= OS_NUMBER_OF_ALARMS)
+    {
+        status = E_OS_ID;
+    }
+    else if(Info == NULL_PTR)
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        *Info = Os_CounterConfig[Os_AlarmConfig[AlarmID].Counter];
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType GetAlarm(AlarmType AlarmID, TickRefType Tick)
+{
+    StatusType status = E_OK;
+
+    if(AlarmID >= OS_NUMBER_OF_ALARMS)
+    {
+        status = E_OS_ID;
+    }
+    else if(Tick == NULL_PTR)
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        if(g_Alarm_Heap_Position[AlarmID] == OS_ALARM_NOT_RUNNING)
+        {
+            status = E_OS_NOFUNC;
+        }
+        else
+        {
+            *Tick = g_Alarm_Expiry[AlarmID] - g_Counter_Ticks[Os_AlarmConfig[AlarmID].Counter];
+        }
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType SetRelAlarm(AlarmType AlarmID, TickType increment, TickType cycle)
+{
+    StatusType status;
+
+    if(AlarmID >= OS_NUMBER_OF_ALARMS)
+    {
+        status = E_OS_ID;
+    }
+    else if((increment == 0) || (increment > Os_CounterConfig[Os_AlarmConfig[AlarmID].Counter].maxallowedvalue))
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        status = Os_StartAlarm(AlarmID, increment, cycle);
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType SetAbsAlarm(AlarmType AlarmID, TickType start, TickType cycle)
+{
+    StatusType status;
+    TickType max_value;
+    TickType delta;
+
+    if(AlarmID >= OS_NUMBER_OF_ALARMS)
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        max_value = Os_CounterConfig[Os_AlarmConfig[AlarmID].Counter].maxallowedvalue;
+        if(start > max_value)
+        {
+            status = E_OS_VALUE;
+        }
+        else
+        {
+            /* Number of ticks until the counter reaches start, a full counter cycle if it is already there */
+            SuspendAllInterrupts();
+            delta = start - g_Counter_Value[Os_AlarmConfig[AlarmID].Counter];
+            if(start <= g_Counter_Value[Os_AlarmConfig[AlarmID].Counter])
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                delta += max_value + 1;
             }
-	}
+            status = Os_StartAlarm(AlarmID, delta, cycle);
+            ResumeAllInterrupts();
+        }
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType CancelAlarm(AlarmType AlarmID)
+{
+    StatusType status = E_OK;
+
+    if(AlarmID >= OS_NUMBER_OF_ALARMS)
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        if(g_Alarm_Heap_Position[AlarmID] == OS_ALARM_NOT_RUNNING)
+        {
+            status = E_OS_NOFUNC;
+        }
+        else
+        {
+            Os_HeapRemove(Os_AlarmConfig[AlarmID].Counter, AlarmID);
+        }
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType StartScheduleTableRel(ScheduleTableType ScheduleTableID, TickType Offset)
+{
+    StatusType status;
+    TickType max_value;
+
+    if(ScheduleTableID >= OS_NUMBER_OF_SCHEDULE_TABLES)
+    {
+        status = E_OS_ID;
     }
+    else
+    {
+        max_value = Os_CounterConfig[Os_ScheduleTableConfig[ScheduleTableID].Counter].maxallowedvalue;
+        if((Offset == 0) || (Offset > (max_value - Os_ScheduleTableConfig[ScheduleTableID].ExpiryPoints[0].Offset)))
+        {
+            status = E_OS_VALUE;
+        }
+        else
+        {
+            status = Os_StartScheduleTable(ScheduleTableID, Offset);
+        }
+    }
+    return status;
+}
 
+/*********************************************************************************************/
+StatusType StartScheduleTableAbs(ScheduleTableType ScheduleTableID, TickType Start)
+{
+    StatusType status;
+    TickType max_value;
+    TickType delta;
+    CounterType counter;
+
+    if(ScheduleTableID >= OS_NUMBER_OF_SCHEDULE_TABLES)
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        counter   = Os_ScheduleTableConfig[ScheduleTableID].Counter;
+        max_value = Os_CounterConfig[counter].maxallowedvalue;
+        if(Start > max_value)
+        {
+            status = E_OS_VALUE;
+        }
+        else
+        {
+            /* Number of ticks until the counter reaches start, a full counter cycle if it is already there */
+            SuspendAllInterrupts();
+            delta = Start - g_Counter_Value[counter];
+            if(Start <= g_Counter_Value[counter])
+            {
+                delta += max_value + 1;
+            }
+            status = Os_StartScheduleTable(ScheduleTableID, delta);
+            ResumeAllInterrupts();
+        }
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType StopScheduleTable(ScheduleTableType ScheduleTableID)
+{
+    StatusType status = E_OK;
+
+    if(ScheduleTableID >= OS_NUMBER_OF_SCHEDULE_TABLES)
+    {
+        status = E_OS_ID;
+    }
+    else
+    {
+        SuspendAllInterrupts();
+        if(g_SchTbl_Status[ScheduleTableID] == SCHEDULETABLE_STOPPED)
+        {
+            status = E_OS_NOFUNC;
+        }
+        else
+        {
+            Os_HeapRemove(Os_ScheduleTableConfig[ScheduleTableID].Counter, OS_SCHTBL_ALARM(ScheduleTableID));
+            g_SchTbl_Status[ScheduleTableID] = SCHEDULETABLE_STOPPED;
+        }
+        ResumeAllInterrupts();
+    }
+    return status;
+}
+
+/*********************************************************************************************/
+StatusType GetScheduleTableStatus(ScheduleTableType ScheduleTableID, ScheduleTableStatusRefType ScheduleStatus)
+{
+    StatusType status = E_OK;
+
+    if(ScheduleTableID >= OS_NUMBER_OF_SCHEDULE_TABLES)
+    {
+        status = E_OS_ID;
+    }
+    else if(ScheduleStatus == NULL_PTR)
+    {
+        status = E_OS_VALUE;
+    }
+    else
+    {
+        *ScheduleStatus = g_SchTbl_Status[ScheduleTableID];
+    }
+    return status;
 }
 /*********************************************************************************************/
@@ -14,22 +14,294 @@
 
 #include "Std_Types.h"
 
+/* Os Module Id */
+#define OS_MODULE_ID    (1U)
+
+/* Os Instance Id */
+#define OS_INSTANCE_ID  (0U)
+
 /* Timer counting time in ms */
 #define OS_BASE_TIME 20
 
-/* Description: 
+/* Number of Os ticks used to compute the rolling cpu load average (1 second) */
+#define OS_CPU_LOAD_WINDOW_TICKS (1000 / OS_BASE_TIME)
+
+/*******************************************************************************
+ *                              OSEK Data Types                                *
+ *******************************************************************************/
+
+/* Type definition for the status returned by the OSEK services */
+typedef uint8  StatusType;
+
+/* Type definition for the Task Id's */
+typedef uint8  TaskType;
+
+/* Type definition for the Counter Id's */
+typedef uint8  CounterType;
+
+/* Type definition for the Alarm Id's */
+typedef uint16 AlarmType;
+
+/* Type definition for the Schedule Table Id's */
+typedef uint8  ScheduleTableType;
+
+/* Type definition for the state of a schedule table */
+typedef uint8  ScheduleTableStatusType;
+typedef ScheduleTableStatusType * ScheduleTableStatusRefType;
+
+/* Type definition for the Counter values in ticks */
+typedef uint32 TickType;
+typedef TickType * TickRefType;
+
+/* Description: Structure to hold the characteristics of the counter an alarm is based on:
+ *  1. maxallowedvalue --> maximum value of the counter before it wraps to zero
+ *  2. ticksperbase    --> number of ticks required to reach a counter specific unit
+ *  3. mincycle        --> smallest allowed value for the cycle of a cyclic alarm
+ */
+typedef struct
+{
+    TickType maxallowedvalue;
+    TickType ticksperbase;
+    TickType mincycle;
+}AlarmBaseType;
+typedef AlarmBaseType * AlarmBaseRefType;
+
+/* OSEK status codes (E_OK is defined in Std_Types.h) */
+#define E_OS_ACCESS     ((StatusType)1U)
+#define E_OS_CALLEVEL   ((StatusType)2U)
+#define E_OS_ID         ((StatusType)3U)
+#define E_OS_LIMIT      ((StatusType)4U)
+#define E_OS_NOFUNC     ((StatusType)5U)
+#define E_OS_RESOURCE   ((StatusType)6U)
+#define E_OS_STATE      ((StatusType)7U)
+#define E_OS_VALUE      ((StatusType)8U)
+
+/* Action done by an alarm when it expires */
+#define OS_ALARM_ACTION_ACTIVATETASK  (0U)
+#define OS_ALARM_ACTION_CALLBACK      (1U)
+
+/* States of a schedule table */
+#define SCHEDULETABLE_STOPPED         ((ScheduleTableStatusType)0U)
+#define SCHEDULETABLE_RUNNING         ((ScheduleTableStatusType)2U)
+
+/* Bit of the task in a mask of activated tasks */
+#define OS_TASK_MASK(TASK)            ((uint32)1U << (TASK))
+
+/* Pattern written to the unused stack by ResetISR (STACK_PAINT_PATTERN in tm4c123gh6pm_startup_ccs.c) */
+#define OS_STACK_PAINT_PATTERN        (0xA5A5A5A5UL)
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for the stack monitoring done by the Os Scheduler */
+#define OS_STACK_MONITOR_SID          (uint8)0x80
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report a stack used down to its guard zone (an overflow is about to happen) */
+#define OS_E_STACK_GUARD              (uint8)0x80
+
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure to hold the measured cpu load in percent:
+ *  1. TickLoad    --> load measured during the last Os tick
+ *  2. AverageLoad --> rolling average load over the last second
+ *  3. PeakLoad    --> highest load measured in a single Os tick since startup
+ */
+typedef struct
+{
+    uint8 TickLoad;
+    uint8 AverageLoad;
+    uint8 PeakLoad;
+}Os_CpuLoadType;
+
+/* Description: Structure to configure each monitored stack:
+ *  1. the lowest address of the stack (the stack grows down to it)
+ *  2. the address after the highest word of the stack (initial stack pointer)
+ */
+typedef struct
+{
+    uint32 * Bottom;
+    uint32 * Top;
+}Os_StackConfigType;
+
+/* Description: Structure to hold the usage of a stack:
+ *  1. Size    --> size of the stack in bytes
+ *  2. MaxUsed --> highest number of bytes used since reset (high-water mark)
+ */
+typedef struct
+{
+    uint32 Size;
+    uint32 MaxUsed;
+}Os_StackUsageType;
+
+/* Description: Structure to configure each Os task:
+ *  1. the function executed when the task is dispatched
+ *  2. TRUE if the task preempts a running lower priority task as soon as it is activated (OS_PREEMPTION),
+ *     FALSE if it waits for the next pass of the Os Scheduler
+ */
+typedef struct
+{
+    void (*Entry)(void);
+    boolean Preemptive;
+}Os_TaskConfigType;
+
+/* Description: Structure to configure each alarm:
+ *  1. the counter which drives the alarm
+ *  2. the action done on expiry --> OS_ALARM_ACTION_ACTIVATETASK or OS_ALARM_ACTION_CALLBACK
+ *  3. the task activated on expiry (ACTIVATETASK action only)
+ *  4. the function called on expiry in the counter interrupt context (CALLBACK action only)
+ */
+typedef struct
+{
+    CounterType Counter;
+    uint8 Action;
+    TaskType Task;
+    void (*Callback)(void);
+}Os_AlarmConfigType;
+
+/* Description: Structure to configure an alarm started by Os_start:
+ *  1. the alarm Id
+ *  2. the relative offset of the first expiry in counter ticks
+ *  3. the cycle in counter ticks (0 for a single shot alarm)
+ */
+typedef struct
+{
+    AlarmType Alarm;
+    TickType Increment;
+    TickType Cycle;
+}Os_AlarmAutostartType;
+
+/* Description: Structure to configure an expiry point of a schedule table:
+ *  1. the offset from the start of the table in counter ticks
+ *  2. the mask of the tasks activated at this offset (OS_TASK_MASK of each task)
+ */
+typedef struct
+{
+    TickType Offset;
+    uint32 TaskMask;
+}Os_ExpiryPointType;
+
+/* Description: Structure to configure each schedule table:
+ *  1. the counter which drives the schedule table
+ *  2. the duration of one round of the table in counter ticks
+ *  3. TRUE if the table starts again from its first expiry point after the duration
+ *  4. the expiry points sorted by increasing offset (offsets lower than the duration)
+ *  5. the number of expiry points
+ *  6. the relative offset used to start the table by Os_start (0 if it is not started by Os_start)
+ */
+typedef struct
+{
+    CounterType Counter;
+    TickType Duration;
+    boolean Repeating;
+    const Os_ExpiryPointType * ExpiryPoints;
+    uint8 NumberOfExpiryPoints;
+    TickType AutostartOffset;
+}Os_ScheduleTableConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description:
  * Function responsible for:
  * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 2. Execute the Init Task
+ * 3. Start the Os timer
+ * 4. Calibrate the idle loop used for the cpu load measurement
+ * 5. Start the autostart alarms and schedule tables
+ * 6. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void);
 
+#if (OS_PREEMPTION == STD_ON)
+/* Description: PendSV exception handler, runs the activated preemptive tasks at the lowest exception priority */
+void PendSV_Handler(void);
+#endif
+
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Function called by Mcu after each change of the system clock frequency */
+void Os_ClockNotification(void);
+
+/* Description: Read the cpu load measured from the idle portion of the Os Scheduler */
+void Os_GetCpuLoad(Os_CpuLoadType * CpuLoad);
+
+/* Description: Read the size and the high-water mark of a monitored stack */
+StatusType Os_GetStackUsage(uint8 StackID, Os_StackUsageType * Usage);
+
+/* Description: Read the core cycles from the reset handler to Os_start on the 16 MHz reset clock,
+ *              counted by the DWT cycle counter started in ResetISR (FAST_STARTUP in Startup_Cfg.h) */
+uint32 Os_GetStartupCycles(void);
+
+/* Description: Set the task ready, it is dispatched by the Os Scheduler according to its priority,
+ *              it can be called from the interrupts (e.g. Icu notifications) to activate event driven tasks */
+StatusType ActivateTask(TaskType TaskID);
+
+/* Description: Disable all the interrupts, calls can be nested */
+void SuspendAllInterrupts(void);
+
+/* Description: Restore the interrupts state saved by the first SuspendAllInterrupts call */
+void ResumeAllInterrupts(void);
+
+/* Description: Increment a software counter by one tick and process its expired alarms */
+StatusType IncrementCounter(CounterType CounterID);
+
+/* Description: Read the current value of a counter */
+StatusType GetCounterValue(CounterType CounterID, TickRefType Value);
+
+/* Description: Read the characteristics of the counter which drives the alarm */
+StatusType GetAlarmBase(AlarmType AlarmID, AlarmBaseRefType Info);
+
+/* Description: Read the number of ticks before the alarm expires */
+StatusType GetAlarm(AlarmType AlarmID, TickRefType Tick);
+
+/* Description: Start the alarm to expire after increment ticks, then every cycle ticks if cycle is not 0 */
+StatusType SetRelAlarm(AlarmType AlarmID, TickType increment, TickType cycle);
+
+/* Description: Start the alarm to expire when the counter reaches start, then every cycle ticks if cycle is not 0 */
+StatusType SetAbsAlarm(AlarmType AlarmID, TickType start, TickType cycle);
+
+/* Description: Stop a running alarm */
+StatusType CancelAlarm(AlarmType AlarmID);
+
+/* Description: Start the schedule table, its first expiry point is processed offset ticks from now */
+StatusType StartScheduleTableRel(ScheduleTableType ScheduleTableID, TickType Offset);
+
+/* Description: Start the schedule table when its counter reaches start */
+StatusType StartScheduleTableAbs(ScheduleTableType ScheduleTableID, TickType Start);
+
+/* Description: Stop a running schedule table */
+StatusType StopScheduleTable(ScheduleTableType ScheduleTableID);
+
+/* Description: Read the state of a schedule table */
+StatusType GetScheduleTableStatus(ScheduleTableType ScheduleTableID, ScheduleTableStatusRefType ScheduleStatus);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Os configuration structures in Os_PBcfg.c */
+extern const Os_TaskConfigType Os_TaskConfig[OS_NUMBER_OF_TASKS];
+extern const AlarmBaseType Os_CounterConfig[OS_NUMBER_OF_COUNTERS];
+extern const Os_AlarmConfigType Os_AlarmConfig[OS_NUMBER_OF_ALARMS];
+extern const Os_StackConfigType Os_StackConfig[OS_NUMBER_OF_STACKS];
+#if (OS_NUMBER_OF_AUTOSTART_ALARMS > 0U)
+extern const Os_AlarmAutostartType Os_AlarmAutostart[OS_NUMBER_OF_AUTOSTART_ALARMS];
+#endif
+
+/* Os schedule tables in Os_SchTbl_PBcfg.c generated by Tools/Os_SchGen */
+extern const Os_ScheduleTableConfigType Os_ScheduleTableConfig[OS_NUMBER_OF_SCHEDULE_TABLES];
+
 #endif /* OS_H_ */
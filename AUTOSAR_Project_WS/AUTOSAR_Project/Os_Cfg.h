@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Os Module
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Pre-compile option for Development Error Detect */
+#define OS_DEV_ERROR_DETECT              (STD_ON)
+
+/* Pre-compile option for the preemption of the running task by the activated preemptive tasks (using PendSV) */
+#define OS_PREEMPTION                    (STD_ON)
+
+/* Number of the configured tasks (32 tasks maximum) */
+#define OS_NUMBER_OF_TASKS               (3U)
+
+/* Task Id's ... the task with the lower Id runs first when several tasks are ready */
+#define OS_TASK_BUTTON                   (TaskType)0
+#define OS_TASK_APP                      (TaskType)1
+#define OS_TASK_LED                      (TaskType)2
+
+/* Number of the configured counters */
+#define OS_NUMBER_OF_COUNTERS            (1U)
+
+/* Counter Id's ... the system counter is incremented every Os tick (OS_BASE_TIME) */
+#define OS_COUNTER_SYSTEM                (CounterType)0
+
+/* Maximum value of the system counter before it wraps (must not exceed 0x7FFFFFFF) */
+#define OS_SYSTEM_COUNTER_MAX_VALUE      (0xFFFFU)
+
+/* Number of the configured alarms */
+#define OS_NUMBER_OF_ALARMS              (1U)
+
+/* Alarm Id's ... OS_ALARM_BUTTON samples the button again while its debouncing is in progress */
+#define OS_ALARM_BUTTON                  (AlarmType)0
+
+/* Number of the alarms started by Os_start ... the periodic tasks are activated by OS_SCHTBL_PERIODIC */
+#define OS_NUMBER_OF_AUTOSTART_ALARMS    (0U)
+
+/* Number of the configured schedule tables */
+#define OS_NUMBER_OF_SCHEDULE_TABLES     (1U)
+
+/* Schedule Table Id's */
+#define OS_SCHTBL_PERIODIC               (ScheduleTableType)0
+
+/* Number of the monitored stacks ... all the tasks and the interrupts use the main stack */
+#define OS_NUMBER_OF_STACKS              (1U)
+
+/* Stack Id's */
+#define OS_STACK_MAIN                    (0U)
+
+/* Number of stack words checked by each idle pass of the Os Scheduler to find the high-water mark */
+#define OS_STACK_SCAN_WORDS              (4U)
+
+/* Number of words at the bottom of each stack which must never be used, reaching them is reported to Det */
+#define OS_STACK_GUARD_WORDS             (16U)
+
+/* Enter the Mcu sleep modes from the idle portion of the Os Scheduler (needs GPT_TIMESTAMP_API) */
+#define OS_IDLE_SLEEP                    (STD_ON)
+
+#endif /* OS_CFG_H_ */
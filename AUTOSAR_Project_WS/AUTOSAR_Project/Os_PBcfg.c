@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Configuration Source file for Os Scheduler - Tasks, Counters, Alarms and Stacks.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Linker symbols of the main stack (tm4c123gh6pm.cmd) */
+extern uint32 __stack;
+extern uint32 __STACK_TOP;
+
+/* Os tasks ordered by Task Id --> Entry, Preemptive */
+const Os_TaskConfigType Os_TaskConfig[OS_NUMBER_OF_TASKS] = {
+                                                                {Button_Task, TRUE},    /* OS_TASK_BUTTON ... activated by the button changes */
+                                                                {App_Task,    TRUE},    /* OS_TASK_APP    ... activated by the gestures    */
+                                                                {Led_Task,    FALSE}    /* OS_TASK_LED    ... OS_SCHTBL_PERIODIC         */
+                                                            };
+
+/* Os counters ordered by Counter Id --> maxallowedvalue, ticksperbase, mincycle */
+const AlarmBaseType Os_CounterConfig[OS_NUMBER_OF_COUNTERS] = {
+                                                                  {OS_SYSTEM_COUNTER_MAX_VALUE, 1, 1}   /* OS_COUNTER_SYSTEM */
+                                                              };
+
+/* Os alarms ordered by Alarm Id --> Counter, Action, Task, Callback */
+const Os_AlarmConfigType Os_AlarmConfig[OS_NUMBER_OF_ALARMS] = {
+                                                                   {OS_COUNTER_SYSTEM, OS_ALARM_ACTION_ACTIVATETASK, OS_TASK_BUTTON, NULL_PTR}
+                                                               };
+
+/* No alarm is started by Os_start ... the periodic tasks are activated by the OS_SCHTBL_PERIODIC
+ * schedule table in Os_SchTbl_PBcfg.c. The Os_AlarmAutostart array --> Alarm, Increment, Cycle
+ * (in Os ticks of OS_BASE_TIME) is only defined when OS_NUMBER_OF_AUTOSTART_ALARMS is not 0 */
+
+/* Os monitored stacks ordered by Stack Id --> Bottom, Top */
+const Os_StackConfigType Os_StackConfig[OS_NUMBER_OF_STACKS] = {
+                                                                  {&__stack, &__STACK_TOP}   /* OS_STACK_MAIN */
+                                                              };
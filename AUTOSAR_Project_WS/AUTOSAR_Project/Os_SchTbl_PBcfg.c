@@ -0,0 +1,25 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_SchTbl_PBcfg.c
+ *
+ * Description: Schedule table of the periodic tasks generated by Tools/Os_SchGen,
+ *              do not edit ... update Os_SchGen_Tasks.txt and run the tool again.
+ *              Worst case frame load: 6 us per 20 ms tick.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+
+/* Expiry points of OS_SCHTBL_PERIODIC --> Offset (in Os ticks), Mask of the activated tasks */
+static const Os_ExpiryPointType Os_SchTbl_Periodic_ExpiryPoints[] = {
+    {0, OS_TASK_MASK(OS_TASK_LED)}
+};
+
+/* Os schedule tables ordered by Schedule Table Id --> Counter, Duration, Repeating, Expiry points,
+ * Number of expiry points, Autostart offset (0 if not started by Os_start) */
+const Os_ScheduleTableConfigType Os_ScheduleTableConfig[OS_NUMBER_OF_SCHEDULE_TABLES] = {
+    {OS_COUNTER_SYSTEM, 2, TRUE, Os_SchTbl_Periodic_ExpiryPoints, 1, 1}   /* OS_SCHTBL_PERIODIC */
+};
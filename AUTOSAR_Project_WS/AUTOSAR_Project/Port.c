@@ -43,6 +43,12 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;         /* Status of the Port m
 STATIC boolean error = FALSE;                            /* Error flag */
 
 STATIC uint8 i =0;                                        /* Loop counter */
+
+STATIC boolean Port_LevelsPreloaded = FALSE;             /* GPIODATA already holds the output levels */
+
+/* GPIO Ports base addresses indexed by the port number */
+STATIC const uint32 Port_BaseAddresses[] = { GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+                                             GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS };
 /************************************************************************************
 * Service Name: PORT_Init
 * Sync/Async: Synchronous
@@ -119,6 +125,52 @@ void PORT_Init(const Port_ConfigType * ConfigPtr)
         Port_SetPinMode(PortChannels[i].pin_num , PortChannels[i].pin_mode);
     }
     }
+    Port_LevelsPreloaded = FALSE;
+}
+
+/************************************************************************************
+* Service Name: Port_PreloadOutputLevels
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to the configuration structure for Port pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Writes the initial value of each output pin in GPIODATA while the pins are still
+*              inputs, the next PORT_Init then only sets the directions and modes. Used on a warm
+*              boot so Dio_RestoreOutputs can write its saved levels before the pins are driven.
+************************************************************************************/
+void Port_PreloadOutputLevels(const Port_ConfigType * ConfigPtr)
+{
+    volatile uint32 * data_reg;
+    uint8 pin;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_PRELOAD_OUTPUT_LEVELS_SID,
+		     PORT_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	{
+        for(pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+        {
+            if( (ConfigPtr->Pins[pin].direction == OUTPUT) && (ConfigPtr->Pins[pin].port_num < 6) )
+            {
+                data_reg = (volatile uint32 *)((volatile uint8 *)Port_BaseAddresses[ConfigPtr->Pins[pin].port_num] + PORT_DATA_REG_OFFSET);
+                if( ConfigPtr->Pins[pin].initial_value == STD_HIGH)
+                {
+                    SET_BIT(*data_reg , ConfigPtr->Pins[pin].pin_num);
+                }
+                else
+                {
+                    CLEAR_BIT(*data_reg , ConfigPtr->Pins[pin].pin_num);
+                }
+            }
+        }
+        Port_LevelsPreloaded = TRUE;
+	}
 }
 /************************************************************************************
 * Service Name: PORT_SetDirection
@@ -174,9 +226,13 @@ void PORT_SetDirection(Port_Pin pin_num , Port_PinDirection dirction)
 
     if( PortChannels[i].direction == OUTPUT)
     {
-	    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) ,  pin_num);               /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        
-        if( PortChannels[i].initial_value == STD_HIGH)
+        /* The level is written before the direction so the pin is never driven with the reset level,
+         * it is kept when Port_PreloadOutputLevels (and Dio_RestoreOutputs) already wrote it */
+        if( Port_LevelsPreloaded == TRUE)
+        {
+            /* Do Nothing ... GPIODATA already holds the level */
+        }
+        else if( PortChannels[i].initial_value == STD_HIGH)
         {
             SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) ,  pin_num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
         }
@@ -184,6 +240,8 @@ void PORT_SetDirection(Port_Pin pin_num , Port_PinDirection dirction)
         {
             CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) ,  pin_num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
         }
+
+	    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) ,  pin_num);               /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
     }
     else if( PortChannels[i].direction == INPUT)
     {
@@ -284,26 +342,28 @@ void Port_SetPinMode( Port_Pin pin_num, Port_PinMode pin_mode)
             * PD4 - PD5 - PD6 - PD7
             * PE0 -  PE1 - PE4 - PE5*/
             case UART_MODE:  
-                if(((  PortChannels->port_num == 0) && (( pin_num == 0) || ( pin_num == 1))) ||
-                    ((  PortChannels->port_num == 1) && (( pin_num == 0) || ( pin_num == 1))) ||
-                    ((  PortChannels->port_num == 2) && (( pin_num == 4) || ( pin_num == 5) || ( pin_num == 6) || ( pin_num == 7))) ||
-                    ((  PortChannels->port_num == 3) && (( pin_num == 4) || ( pin_num == 5) || ( pin_num == 6) || ( pin_num == 7))) ||
-                    ((  PortChannels->port_num == 4) && (( pin_num == 0) || ( pin_num == 1) || ( pin_num == 4) || ( pin_num == 5))))
+                if(((PortChannels[i].port_num == 0) && (( pin_num == 0) || ( pin_num == 1))) ||
+                    ((PortChannels[i].port_num == 1) && (( pin_num == 0) || ( pin_num == 1))) ||
+                    ((PortChannels[i].port_num == 2) && (( pin_num == 4) || ( pin_num == 5) || ( pin_num == 6) || ( pin_num == 7))) ||
+                    ((PortChannels[i].port_num == 3) && (( pin_num == 4) || ( pin_num == 5) || ( pin_num == 6) || ( pin_num == 7))) ||
+                    ((PortChannels[i].port_num == 4) && (( pin_num == 0) || ( pin_num == 1) || ( pin_num == 4) || ( pin_num == 5))))
                 {
                     /* Enable alternate function */
                     SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),  pin_num);
-                    /* Set PMCx bits to UART function */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000E << ( pin_num * 4));
-                    /* Enable Digital functionality */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),  pin_num);
-                }
-                else if(((  PortChannels->port_num  == 2) && (( pin_num == 4) || ( pin_num == 5))))
-                {
+                    /* Set PMCx bits to UART function: 1, or 2 for U1Rx/U1Tx on PC4/PC5 */
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ( pin_num * 4));
 #ifdef U1
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000D << (pin_num * 4));
-#else 
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000E << ( pin_num * 4));
+                    if((PortChannels[i].port_num == 2) && (( pin_num == 4) || ( pin_num == 5)))
+                    {
+                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000002 << ( pin_num * 4));
+                    }
+                    else
 #endif
+                    {
+                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000001 << ( pin_num * 4));
+                    }
+                    /* Enable Digital functionality */
+                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),  pin_num);
                 }
                 else 
                 {
@@ -359,13 +419,33 @@ void Port_SetPinMode( Port_Pin pin_num, Port_PinMode pin_mode)
                 /* Configure the pin for Watchdog mode (PMCx = 0) */
                 *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ( pin_num * 4));
                break;
-            case PWM_MODE:   /*PWM Pins in Tiva_C ==> PB4 - PB5 - PB6 - PB7  - PC4 - PC5 - PD0 - PD1*/
-                if((((PortChannels->port_num == 1) && ( pin_num == 4) || (( pin_num == 5) || ( pin_num == 6) || ( pin_num == 7))))
-                || (((PortChannels->port_num == 2) && (( pin_num == 4) || ( pin_num == 5))))
-                || ((PortChannels->port_num == 3) && (( pin_num == 0) || ( pin_num == 1))))
+            /*PWM Pins in Tiva_C ==> M0PWM (PMCx = 4): PB4 - PB5 - PB6 - PB7 - PC4 - PC5 - PD0 - PD1 - PE4 - PE5
+            * M1PWM (PMCx = 5): PA6 - PA7 - PF0 - PF1 - PF2 - PF3 - PD0 - PD1 - PE4 - PE5*/
+            case PWM_MODE:
+                if(((PortChannels[i].port_num == 1) && ( pin_num >= 4))
+                || ((PortChannels[i].port_num == 2) && (( pin_num == 4) || ( pin_num == 5))))
                 {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),  pin_num);
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000B << ( pin_num * 4));                        
+                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),  pin_num);
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ( pin_num * 4));
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000004 << ( pin_num * 4));
+                }
+                else if(((PortChannels[i].port_num == 0) && (( pin_num == 6) || ( pin_num == 7)))
+                     || ((PortChannels[i].port_num == 5) && ( pin_num <= 3)))
+                {
+                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),  pin_num);
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ( pin_num * 4));
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000005 << ( pin_num * 4));
+                }
+                else if(((PortChannels[i].port_num == 3) && (( pin_num == 0) || ( pin_num == 1)))
+                     || ((PortChannels[i].port_num == 4) && (( pin_num == 4) || ( pin_num == 5))))
+                {
+                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),  pin_num);
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << ( pin_num * 4));
+#ifdef M1PWM
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000005 << ( pin_num * 4));
+#else
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000004 << ( pin_num * 4));
+#endif
                 }
                 else
                 {
@@ -77,6 +77,8 @@ typedef uint8 Port_Pin;                                 /* Represents the pin nu
 #define PORT_INIT_SID                       (uint8)0x00          /* Service ID for initializing the Port module */
 /* Service ID for Port_SetPinMode */
 #define PORT_SET_PIN_MODE_SID               (uint8)0x04           /* Service ID for setting pin mode */   
+/* Service ID for Port_PreloadOutputLevels */
+#define PORT_PRELOAD_OUTPUT_LEVELS_SID      (uint8)0x80           /* Service ID for preloading the output levels */
 
 /*******************************************************************************
  *                      DET Error Codes                                        *
@@ -126,36 +128,6 @@ typedef uint8 Port_Pin;                                 /* Represents the pin nu
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
-/* UART Registers based Addresses */
-#define UART0                            0x4000C000
-#define UART1                            0x4000D000
-#define UART2                            0x4000E000
-#define UART3                            0x4000F000
-#define UART4                            0x40010000
-#define UART5                            0x40011000
-#define UART6                            0x40012000
-#define UART7                            0x40013000
-
-/* UART Registers offset addresses */
-#define UART_RSR_REG                     0x004          
-#define UART_ECR_REG                     0x004          
-#define UART_FR_REG                      0x018             
-#define UART_ILPR_REG                    0x020         
-#define UART_IBRD_REG                    0x028      
-#define UART_FBRD_REG                    0x02C      
-#define UART_LCRH_REG                    0x030      
-#define UART_CTL_REG                     0x034      
-#define UART_IFLS_REG                    0x038      
-#define UART_IM_REG                      0x03C      
-#define UART_RIS_REG                     0x03C      
-#define UART_MIS_REG                     0x040      
-#define UART_ICR_REG                     0x044      
-#define UART_DMACTL_REG                  0x048      
-#define UART_9BITADDR_REG                0x0A4      
-#define UART_9BITAMASK_REG               0x0A8     
-#define UART_PP_REG                      0xFC0      
-#define UART_CC_REG                      0xFC8      
-
 
 /*******************************************************************************
  *                              Module Data Types                              *
@@ -253,5 +225,18 @@ void Port_SetPinMode( Port_Pin pin_num , Port_PinMode pin_mode);
 * Description: Sets the direction of a specific pin (INPUT or OUTPUT).
 ************************************************************************************/
 void PORT_SetDirection(Port_Pin pin_num , Port_PinDirection dirction);
+/************************************************************************************
+* Service Name: Port_PreloadOutputLevels
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to the configuration structure for Port pins
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Writes the initial value of each output pin in GPIODATA while the pins are still
+*              inputs, the next PORT_Init then only sets the directions and modes. Used on a warm
+*              boot so Dio_RestoreOutputs can write its saved levels before the pins are driven.
+************************************************************************************/
+void Port_PreloadOutputLevels(const Port_ConfigType * ConfigPtr);
 
 #endif /* PORT_H */
@@ -25,6 +25,7 @@
 
 #include "Port.h"
 #include "Port_Cfg.h"
+#include "Board_Cfg.h"
 
 /* AUTOSAR Version checking between Port_PBcfg.c and Port.h files */
 #if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\
@@ -40,6 +41,13 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* Mode of the LED pins PF1 .. PF3: driven by the PWM generators or toggled as GPIO by SwPwm (LED_BACKEND in Board_Cfg.h) */
+#if (LED_BACKEND == LED_BACKEND_PWM)
+#define PORT_LED_PIN_MODE    PWM_MODE
+#else
+#define PORT_LED_PIN_MODE    GPIO_MODE
+#endif
+
 /* 
  * PB (Post-Build) structure used with Port_Init API.
  * This structure contains the configuration for all GPIO pins.
@@ -53,8 +61,8 @@
  */
 const Port_ConfigType Port_PinConfig = {
                                         /* Port A Configuration */
-                                        0,0,OUTPUT,OFF,STD_HIGH,GPIO_MODE,
-                                        0,1,INPUT,PULL_UP,STD_HIGH,GPIO_MODE,
+                                        0,0,INPUT,PULL_UP,STD_HIGH,UART_MODE,      /* U0Rx */
+                                        0,1,OUTPUT,OFF,STD_HIGH,UART_MODE,         /* U0Tx */
                                         0,2,INPUT,PULL_UP,STD_HIGH,GPIO_MODE,
                                         0,3,INPUT,PULL_UP,STD_HIGH,GPIO_MODE,
                                         0,4,INPUT,PULL_UP,STD_HIGH,GPIO_MODE,
@@ -97,9 +105,9 @@ const Port_ConfigType Port_PinConfig = {
                                         4,5,INPUT,PULL_UP,STD_HIGH,GPIO_MODE,
                                         /* Port F Configuration */
                                         5,0,OUTPUT,OFF,STD_HIGH,GPIO_MODE,
-                                        5,1,OUTPUT,OFF,STD_LOW,GPIO_MODE,
-                                        5,2,INPUT,OFF,STD_LOW,GPIO_MODE,
-                                        5,3,INPUT,OFF,STD_LOW,GPIO_MODE,
+                                        5,1,OUTPUT,OFF,STD_LOW,PORT_LED_PIN_MODE,     /* M1PWM5 (Red LED) */
+                                        5,2,OUTPUT,OFF,STD_LOW,PORT_LED_PIN_MODE,     /* M1PWM6 (Blue LED) */
+                                        5,3,OUTPUT,OFF,STD_LOW,PORT_LED_PIN_MODE,     /* M1PWM7 (Green LED) */
                                         5,4,INPUT,PULL_UP,STD_HIGH,GPIO_MODE                                    
 };
 
@@ -0,0 +1,838 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Pwm.h"
+#include "Pwm_Regs.h"
+#include "Mcu.h"
+#include "Os.h"
+
+#if (PWM_WARM_BOOT_API == STD_ON)
+#include "NoInit.h"
+#endif
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+#include "Irq.h"
+#endif
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Pwm Modules */
+#if ((DET_AR_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Number of the generators: 4 in each PWM module, generator g is generator g % 4 of module g / 4 */
+#define PWM_NUMBER_OF_GENERATORS    (8U)
+#define PWM_GENERATORS_PER_MODULE   (4U)
+
+/* Generator of a hardware output and output of the generator (0 --> A, 1 --> B) */
+#define PWM_HW_GENERATOR(HW)        ((uint8)((uint8)(HW) >> 1))
+#define PWM_HW_OUTPUT(HW)           ((uint8)((uint8)(HW) & 1U))
+
+/* Output with no configured channel */
+#define PWM_NO_CHANNEL              (0xFFU)
+
+/* TRUE if a channel is configured on one of the outputs of the generator */
+#define PWM_GENERATOR_USED(GEN)     ((boolean)((PWM_NO_CHANNEL != Pwm_GeneratorChannels[GEN][0]) || (PWM_NO_CHANNEL != Pwm_GeneratorChannels[GEN][1])))
+
+/* Longest period of the 16 bits counters (LOAD = 0xFFFF) */
+#define PWM_MAX_PERIOD_TICKS        (0x10000UL)
+
+/* Unit of the frequencies used to rescale the periods, it keeps the products in 32 bits */
+#define PWM_CLOCK_SCALE_HZ          (10000UL)
+
+/* Base address of each PWM module */
+STATIC const uint32 Pwm_ModuleBaseAddress[2] = { PWM_MODULE0_BASE_ADDRESS, PWM_MODULE1_BASE_ADDRESS };
+
+STATIC const Pwm_ConfigChannel * Pwm_Channels = NULL_PTR;
+STATIC uint8 Pwm_Status = PWM_NOT_INITIALIZED;
+
+/* Channel on the outputs A and B of each generator */
+STATIC uint8 Pwm_GeneratorChannels[PWM_NUMBER_OF_GENERATORS][2];
+
+/* Period of each generator in PWM clock ticks at PWM_REFERENCE_CLOCK_HZ */
+STATIC Pwm_PeriodType Pwm_Period[PWM_NUMBER_OF_GENERATORS];
+
+/* Duty cycle of each channel and TRUE while it is set to its idle state */
+STATIC Pwm_DutyCycleType Pwm_DutyCycle[PWM_NUMBER_OF_CHANNELS];
+STATIC boolean Pwm_Idle[PWM_NUMBER_OF_CHANNELS];
+
+/* System clock frequency used to compute the generators periods */
+STATIC uint32 Pwm_ClockFrequency = PWM_REFERENCE_CLOCK_HZ;
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/* Peripheral interrupt of each generator */
+STATIC const Irq_NumberType Pwm_GeneratorIrq[PWM_NUMBER_OF_GENERATORS] = { 10U, 11U, 12U, 45U, 134U, 135U, 136U, 137U };
+
+/* Generator events which call the notification of each channel and TRUE while its output has edges
+ * (a duty cycle of 0%, 100% or the idle state keeps the output at a constant level) */
+STATIC uint32 Pwm_NotificationEvents[PWM_NUMBER_OF_CHANNELS];
+STATIC boolean Pwm_Toggling[PWM_NUMBER_OF_CHANNELS];
+#endif
+
+#if (PWM_WARM_BOOT_API == STD_ON)
+/* Description: Structure of the outputs kept across the software and watchdog resets:
+ *  1. PWM_WARM_BOOT_SIGNATURE once the record is written
+ *  2. the period of each generator, the duty cycle and the idle state of each channel
+ *  3. the checksum of the record, a write interrupted by a reset leaves it invalid
+ */
+typedef struct
+{
+	uint32 Signature;
+	Pwm_PeriodType Periods[PWM_NUMBER_OF_GENERATORS];
+	Pwm_DutyCycleType DutyCycles[PWM_NUMBER_OF_CHANNELS];
+	boolean Idle[PWM_NUMBER_OF_CHANNELS];
+	uint32 Checksum;
+} Pwm_OutputRecordType;
+
+#define PWM_RECORD_WORDS               NOINIT_RECORD_WORDS(Pwm_OutputRecordType)
+
+#pragma DATA_SECTION(Pwm_OutputRecord, ".noinit")
+STATIC Pwm_OutputRecordType Pwm_OutputRecord;
+
+/************************************************************************************
+* Description: Save the periods, duty cycles and idle states in the output record,
+*              called from the critical section of Pwm_UpdateGenerator
+************************************************************************************/
+STATIC void Pwm_SaveOutputs(void)
+{
+	uint8 index;
+
+	for(index = 0; index < PWM_NUMBER_OF_GENERATORS; index++)
+	{
+		Pwm_OutputRecord.Periods[index] = Pwm_Period[index];
+	}
+	for(index = 0; index < PWM_NUMBER_OF_CHANNELS; index++)
+	{
+		Pwm_OutputRecord.DutyCycles[index] = Pwm_DutyCycle[index];
+		Pwm_OutputRecord.Idle[index]       = Pwm_Idle[index];
+	}
+	NoInit_Seal((uint32 *)&Pwm_OutputRecord, PWM_RECORD_WORDS, PWM_WARM_BOOT_SIGNATURE);
+}
+#endif
+
+/************************************************************************************
+* Description: Number of PWM clock ticks of a period at the current system clock frequency
+************************************************************************************/
+STATIC uint32 Pwm_ScalePeriod(Pwm_PeriodType Period)
+{
+	uint32 ticks = Period;
+
+	if(Pwm_ClockFrequency != PWM_REFERENCE_CLOCK_HZ)
+	{
+		ticks = (ticks * (Pwm_ClockFrequency / PWM_CLOCK_SCALE_HZ)) / (PWM_REFERENCE_CLOCK_HZ / PWM_CLOCK_SCALE_HZ);
+		if(ticks > PWM_MAX_PERIOD_TICKS)
+		{
+			ticks = PWM_MAX_PERIOD_TICKS;
+		}
+	}
+	return ticks;
+}
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/************************************************************************************
+* Description: Enable the generator events of the channels with enabled notifications
+*              and edges on their outputs
+************************************************************************************/
+STATIC void Pwm_UpdateInterrupts(uint8 Generator)
+{
+	uint32 events = 0;
+	uint8 output;
+	uint8 channel;
+
+	for(output = 0; output < 2U; output++)
+	{
+		channel = Pwm_GeneratorChannels[Generator][output];
+		if((PWM_NO_CHANNEL != channel) && (TRUE == Pwm_Toggling[channel]))
+		{
+			events |= Pwm_NotificationEvents[channel];
+		}
+	}
+
+	PWM_GEN_REG(Pwm_ModuleBaseAddress[Generator / PWM_GENERATORS_PER_MODULE],
+	            Generator % PWM_GENERATORS_PER_MODULE, PWM_GEN_INTEN_REG_OFFSET) = events;
+}
+#endif
+
+/************************************************************************************
+* Description: Write the period, compare values and output actions of a generator from its
+*              channels then request their global synchronization, the generator applies
+*              all of them together at the end of its current period.
+*              In count-down mode the output is active from the load of the counter until
+*              the counter reaches the compare value, 0% and 100% drive a constant level.
+************************************************************************************/
+STATIC void Pwm_UpdateGenerator(uint8 Generator)
+{
+	const Pwm_ConfigChannel * config;
+	uint32 base = Pwm_ModuleBaseAddress[Generator / PWM_GENERATORS_PER_MODULE];
+	uint8 gen = Generator % PWM_GENERATORS_PER_MODULE;
+	uint32 period = Pwm_ScalePeriod(Pwm_Period[Generator]);
+	uint32 active;
+	uint32 inactive;
+	uint32 action;
+	uint32 high;
+	uint32 compare;
+	uint8 output;
+	uint8 channel;
+	boolean toggling;
+
+	SuspendAllInterrupts();
+
+	if(period != 0)
+	{
+		PWM_GEN_REG(base, gen, PWM_GEN_LOAD_REG_OFFSET) = period - 1U;
+	}
+
+	for(output = 0; output < 2U; output++)
+	{
+		channel = Pwm_GeneratorChannels[Generator][output];
+		if(PWM_NO_CHANNEL != channel)
+		{
+			config = &Pwm_Channels[channel];
+			if(PWM_HIGH == config->Polarity)
+			{
+				active   = PWM_GEN_ACT_HIGH;
+				inactive = PWM_GEN_ACT_LOW;
+			}
+			else
+			{
+				active   = PWM_GEN_ACT_LOW;
+				inactive = PWM_GEN_ACT_HIGH;
+			}
+
+			compare  = 0;
+			toggling = FALSE;
+			high = (period * Pwm_DutyCycle[channel]) / PWM_DUTY_MAX;
+			if(TRUE == Pwm_Idle[channel])
+			{
+				action = (PWM_HIGH == config->IdleState) ? PWM_GEN_ACT_HIGH : PWM_GEN_ACT_LOW;
+				action = (action << PWM_GEN_ACTLOAD_POS) | (action << PWM_GEN_ACTZERO_POS);
+			}
+			else if(0U == high)
+			{
+				action = (inactive << PWM_GEN_ACTLOAD_POS) | (inactive << PWM_GEN_ACTZERO_POS);
+			}
+			else if(high >= period)
+			{
+				action = (active << PWM_GEN_ACTLOAD_POS) | (active << PWM_GEN_ACTZERO_POS);
+			}
+			else
+			{
+				/* Active during the counts LOAD .. compare + 1 */
+				compare = period - 1U - high;
+				action  = (active << PWM_GEN_ACTLOAD_POS)
+				        | (inactive << ((0U == output) ? PWM_GEN_ACTCMPAD_POS : PWM_GEN_ACTCMPBD_POS));
+				toggling = TRUE;
+			}
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+			Pwm_Toggling[channel] = toggling;
+#else
+			(void)toggling;
+#endif
+			if(0U == output)
+			{
+				PWM_GEN_REG(base, gen, PWM_GEN_CMPA_REG_OFFSET) = compare;
+				PWM_GEN_REG(base, gen, PWM_GEN_GENA_REG_OFFSET) = action;
+			}
+			else
+			{
+				PWM_GEN_REG(base, gen, PWM_GEN_CMPB_REG_OFFSET) = compare;
+				PWM_GEN_REG(base, gen, PWM_GEN_GENB_REG_OFFSET) = action;
+			}
+		}
+	}
+
+	/* The new values are taken at the next counter zero, the bit is cleared by the hardware */
+	PWM_REG(base, PWM_CTL_REG_OFFSET) |= (1UL << gen);
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+	Pwm_UpdateInterrupts(Generator);
+#endif
+
+#if (PWM_WARM_BOOT_API == STD_ON)
+	/* The default outputs of Pwm_Init do not overwrite the record kept for Pwm_RestoreOutputs */
+	if(PWM_INITIALIZED == Pwm_Status)
+	{
+		Pwm_SaveOutputs();
+	}
+#endif
+
+	ResumeAllInterrupts();
+}
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/************************************************************************************
+* Description: Common part of the generators ISRs ... acknowledge the events of the generator
+*              and call the notifications of its channels enabled for these events
+************************************************************************************/
+STATIC void Pwm_GeneratorIsr(uint8 Generator)
+{
+	uint32 base = Pwm_ModuleBaseAddress[Generator / PWM_GENERATORS_PER_MODULE];
+	uint8 gen = Generator % PWM_GENERATORS_PER_MODULE;
+	uint32 events;
+	uint8 output;
+	uint8 channel;
+
+	events = PWM_GEN_REG(base, gen, PWM_GEN_ISC_REG_OFFSET);
+	PWM_GEN_REG(base, gen, PWM_GEN_ISC_REG_OFFSET) = events; /* write 1 to clear */
+
+	for(output = 0; output < 2U; output++)
+	{
+		channel = Pwm_GeneratorChannels[Generator][output];
+		if((PWM_NO_CHANNEL != channel) && (0U != (events & Pwm_NotificationEvents[channel]))
+		   && (NULL_PTR != Pwm_Channels[channel].Notification))
+		{
+			Pwm_Channels[channel].Notification();
+		}
+	}
+}
+
+/************************************************************************************
+* Description: Generators ISRs installed by Pwm_Init
+************************************************************************************/
+STATIC void Pwm_Generator0Isr(void)
+{
+	Pwm_GeneratorIsr(0U);
+}
+
+STATIC void Pwm_Generator1Isr(void)
+{
+	Pwm_GeneratorIsr(1U);
+}
+
+STATIC void Pwm_Generator2Isr(void)
+{
+	Pwm_GeneratorIsr(2U);
+}
+
+STATIC void Pwm_Generator3Isr(void)
+{
+	Pwm_GeneratorIsr(3U);
+}
+
+STATIC void Pwm_Generator4Isr(void)
+{
+	Pwm_GeneratorIsr(4U);
+}
+
+STATIC void Pwm_Generator5Isr(void)
+{
+	Pwm_GeneratorIsr(5U);
+}
+
+STATIC void Pwm_Generator6Isr(void)
+{
+	Pwm_GeneratorIsr(6U);
+}
+
+STATIC void Pwm_Generator7Isr(void)
+{
+	Pwm_GeneratorIsr(7U);
+}
+
+/* ISR of each generator */
+STATIC const Irq_HandlerType Pwm_GeneratorHandlers[PWM_NUMBER_OF_GENERATORS] = {
+                                                                                   Pwm_Generator0Isr, Pwm_Generator1Isr,
+                                                                                   Pwm_Generator2Isr, Pwm_Generator3Isr,
+                                                                                   Pwm_Generator4Isr, Pwm_Generator5Isr,
+                                                                                   Pwm_Generator6Isr, Pwm_Generator7Isr
+                                                                               };
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Pwm module:
+*              - Enable the clock of the used PWM modules and set the PWM clock divider
+*              - Start the generators of the channels with their default period and duty cycle
+*              - Enable the channels outputs and install the generators ISRs
+*              The channel pins are configured in PWM_MODE by the Port Driver.
+************************************************************************************/
+void Pwm_Init(const Pwm_ConfigType * ConfigPtr)
+{
+	Pwm_ChannelType channel;
+	uint8 generator;
+	uint8 modules = 0;
+	uint32 base;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID,
+		     PWM_E_PARAM_CONFIG);
+	}
+	else if (PWM_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID,
+		     PWM_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		Pwm_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		Pwm_ClockFrequency = Mcu_GetSysClockFrequency();
+
+		for(generator = 0; generator < PWM_NUMBER_OF_GENERATORS; generator++)
+		{
+			Pwm_GeneratorChannels[generator][0] = PWM_NO_CHANNEL;
+			Pwm_GeneratorChannels[generator][1] = PWM_NO_CHANNEL;
+		}
+
+		for(channel = 0; channel < PWM_NUMBER_OF_CHANNELS; channel++)
+		{
+			generator = PWM_HW_GENERATOR(Pwm_Channels[channel].HwChannel);
+			Pwm_GeneratorChannels[generator][PWM_HW_OUTPUT(Pwm_Channels[channel].HwChannel)] = channel;
+			Pwm_Period[generator]  = Pwm_Channels[channel].DefaultPeriod;
+			Pwm_DutyCycle[channel] = Pwm_Channels[channel].DefaultDutyCycle;
+			Pwm_Idle[channel]      = FALSE;
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+			Pwm_NotificationEvents[channel] = 0;
+#endif
+			modules |= (uint8)(1U << (generator / PWM_GENERATORS_PER_MODULE));
+		}
+
+		/* PWM clock = system clock / PWM_CLOCK_DIVIDER */
+		PWM_SYSCTL_RCC_REG = (PWM_SYSCTL_RCC_REG & ~PWM_RCC_PWMDIV_MASK)
+		                   | ((uint32)PWM_CLOCK_DIVIDER << PWM_RCC_PWMDIV_POS) | (1UL << PWM_RCC_USEPWMDIV_BIT);
+
+		PWM_SYSCTL_RCGCPWM_REG |= modules;
+		while((PWM_SYSCTL_PRPWM_REG & modules) != modules);
+
+		for(generator = 0; generator < PWM_NUMBER_OF_GENERATORS; generator++)
+		{
+			if(TRUE == PWM_GENERATOR_USED(generator))
+			{
+				base = Pwm_ModuleBaseAddress[generator / PWM_GENERATORS_PER_MODULE];
+
+				/* Count-down mode with globally synchronized updates, then the first values */
+				PWM_GEN_REG(base, generator % PWM_GENERATORS_PER_MODULE, PWM_GEN_CTL_REG_OFFSET) =
+				        PWM_GEN_CTL_LOADUPD | PWM_GEN_CTL_CMPAUPD | PWM_GEN_CTL_CMPBUPD
+				      | PWM_GEN_CTL_GENAUPD_GLOBAL | PWM_GEN_CTL_GENBUPD_GLOBAL;
+				Pwm_UpdateGenerator(generator);
+				PWM_GEN_REG(base, generator % PWM_GENERATORS_PER_MODULE, PWM_GEN_CTL_REG_OFFSET) |= PWM_GEN_CTL_ENABLE;
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+				PWM_REG(base, PWM_INTEN_REG_OFFSET) |= (1UL << (generator % PWM_GENERATORS_PER_MODULE));
+				Irq_Register(Pwm_GeneratorIrq[generator], Pwm_GeneratorHandlers[generator], PWM_INTERRUPT_PRIORITY);
+				Irq_EnableInterrupt(Pwm_GeneratorIrq[generator]);
+#endif
+			}
+		}
+
+		for(channel = 0; channel < PWM_NUMBER_OF_CHANNELS; channel++)
+		{
+			base = Pwm_ModuleBaseAddress[PWM_HW_GENERATOR(Pwm_Channels[channel].HwChannel) / PWM_GENERATORS_PER_MODULE];
+			PWM_REG(base, PWM_ENABLE_REG_OFFSET) |= (1UL << ((uint8)Pwm_Channels[channel].HwChannel % 8U));
+		}
+
+		Pwm_Status = PWM_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+* Service Name: Pwm_SetDutyCycle
+* Service ID[hex]: 0x02
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the Pwm channel
+*                  DutyCycle - 0 (always inactive) .. PWM_DUTY_MAX (always active)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel, it leaves the idle state and
+*              the new duty cycle is applied by the generator at the end of the current period.
+************************************************************************************/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, Pwm_DutyCycleType DutyCycle)
+{
+	boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_DUTY_CYCLE_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (PWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_DUTY_CYCLE_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else if (PWM_DUTY_MAX < DutyCycle)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_DUTY_CYCLE_SID, PWM_E_PARAM_DUTY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && ((Pwm_DutyCycle[ChannelNumber] != DutyCycle) || (TRUE == Pwm_Idle[ChannelNumber])))
+	{
+		Pwm_DutyCycle[ChannelNumber] = DutyCycle;
+		Pwm_Idle[ChannelNumber] = FALSE;
+		Pwm_UpdateGenerator(PWM_HW_GENERATOR(Pwm_Channels[ChannelNumber].HwChannel));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (PWM_SET_PERIOD_AND_DUTY_API == STD_ON)
+/************************************************************************************
+* Service Name: Pwm_SetPeriodAndDuty
+* Service ID[hex]: 0x03
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the Pwm channel
+*                  Period - Period in PWM clock ticks at PWM_REFERENCE_CLOCK_HZ (1 .. 0xFFFF)
+*                  DutyCycle - 0 (always inactive) .. PWM_DUTY_MAX (always active)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period and the duty cycle of a variable period channel,
+*              the other output of its generator keeps its duty cycle with the new period.
+*              Both are applied together by the generator at the end of the current period.
+************************************************************************************/
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, Pwm_DutyCycleType DutyCycle)
+{
+	boolean error = FALSE;
+	uint8 generator;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (PWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else if (PWM_FIXED_PERIOD == Pwm_Channels[ChannelNumber].ChannelClass)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_PERIOD_UNCHANGEABLE);
+		error = TRUE;
+	}
+	/* The counters are loaded with Period - 1, Pwm_PeriodType already limits it to 0xFFFF */
+	else if (0U == Period)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_PARAM_PERIOD);
+		error = TRUE;
+	}
+	else if (PWM_DUTY_MAX < DutyCycle)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_PARAM_DUTY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		generator = PWM_HW_GENERATOR(Pwm_Channels[ChannelNumber].HwChannel);
+		Pwm_Period[generator] = Period;
+		Pwm_DutyCycle[ChannelNumber] = DutyCycle;
+		Pwm_Idle[ChannelNumber] = FALSE;
+		Pwm_UpdateGenerator(generator);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_SetOutputToIdle
+* Service ID[hex]: 0x04
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the Pwm channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the output of a channel to its configured idle state at the
+*              end of the current period, Pwm_SetDutyCycle starts the output again.
+************************************************************************************/
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+{
+	boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_OUTPUT_TO_IDLE_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (PWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_SET_OUTPUT_TO_IDLE_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && (FALSE == Pwm_Idle[ChannelNumber]))
+	{
+		Pwm_Idle[ChannelNumber] = TRUE;
+		Pwm_UpdateGenerator(PWM_HW_GENERATOR(Pwm_Channels[ChannelNumber].HwChannel));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/************************************************************************************
+* Service Name: Pwm_DisableNotification
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the Pwm channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the edge notification of a channel.
+************************************************************************************/
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
+{
+	boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_DISABLE_NOTIFICATION_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (PWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_DISABLE_NOTIFICATION_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		SuspendAllInterrupts();
+		Pwm_NotificationEvents[ChannelNumber] = 0;
+		Pwm_UpdateInterrupts(PWM_HW_GENERATOR(Pwm_Channels[ChannelNumber].HwChannel));
+		ResumeAllInterrupts();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Pwm_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the Pwm channel
+*                  Notification - Edges of the output which call the channel notification
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the edge notification of a channel, the edges are the
+*              counter load (start of the active level) and the compare match (end of it),
+*              swapped by the polarity. There is no notification at 0%, 100% or in idle state.
+************************************************************************************/
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification)
+{
+	boolean error = FALSE;
+	uint32 rising;
+	uint32 falling;
+	uint32 events;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_ENABLE_NOTIFICATION_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (PWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+				PWM_ENABLE_NOTIFICATION_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		rising  = PWM_GEN_INT_CNTLOAD;
+		falling = (0U == PWM_HW_OUTPUT(Pwm_Channels[ChannelNumber].HwChannel)) ? PWM_GEN_INT_CMPAD : PWM_GEN_INT_CMPBD;
+		if(PWM_LOW == Pwm_Channels[ChannelNumber].Polarity)
+		{
+			events  = rising;
+			rising  = falling;
+			falling = events;
+		}
+
+		switch(Notification)
+		{
+			case PWM_RISING_EDGE:
+				events = rising;
+				break;
+			case PWM_FALLING_EDGE:
+				events = falling;
+				break;
+			default:
+				events = rising | falling;
+				break;
+		}
+
+		SuspendAllInterrupts();
+		Pwm_NotificationEvents[ChannelNumber] = events;
+		Pwm_UpdateInterrupts(PWM_HW_GENERATOR(Pwm_Channels[ChannelNumber].HwChannel));
+		ResumeAllInterrupts();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_ClockNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by Mcu after each change of the system clock frequency,
+*              the generators periods are rescaled to keep the output frequencies.
+************************************************************************************/
+void Pwm_ClockNotification(void)
+{
+	uint8 generator;
+
+	if(PWM_INITIALIZED == Pwm_Status)
+	{
+		Pwm_ClockFrequency = Mcu_GetSysClockFrequency();
+		for(generator = 0; generator < PWM_NUMBER_OF_GENERATORS; generator++)
+		{
+			if(TRUE == PWM_GENERATOR_USED(generator))
+			{
+				Pwm_UpdateGenerator(generator);
+			}
+		}
+	}
+}
+
+#if (PWM_WARM_BOOT_API == STD_ON)
+/************************************************************************************
+* Service Name: Pwm_RestoreOutputs
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the saved outputs are set back,
+*                                E_NOT_OK if the module is not initialized or the output record is not valid
+* Description: Function to set back the periods, duty cycles and idle states of the channels from
+*              before a software or watchdog reset, it is called after Pwm_Init which starts the
+*              generators with the default outputs. They are applied at the end of the current period.
+************************************************************************************/
+Std_ReturnType Pwm_RestoreOutputs(void)
+{
+	Std_ReturnType ret = E_NOT_OK;
+	Pwm_ChannelType channel;
+	uint8 generator;
+
+	if((PWM_INITIALIZED == Pwm_Status)
+	   && (TRUE == NoInit_IsValid((const uint32 *)&Pwm_OutputRecord, PWM_RECORD_WORDS, PWM_WARM_BOOT_SIGNATURE)))
+	{
+		/* All the values are taken before the first update saves the record again */
+		for(channel = 0; channel < PWM_NUMBER_OF_CHANNELS; channel++)
+		{
+			Pwm_DutyCycle[channel] = Pwm_OutputRecord.DutyCycles[channel];
+			Pwm_Idle[channel]      = Pwm_OutputRecord.Idle[channel];
+		}
+		for(generator = 0; generator < PWM_NUMBER_OF_GENERATORS; generator++)
+		{
+			Pwm_Period[generator] = Pwm_OutputRecord.Periods[generator];
+		}
+		for(generator = 0; generator < PWM_NUMBER_OF_GENERATORS; generator++)
+		{
+			if(TRUE == PWM_GENERATOR_USED(generator))
+			{
+				Pwm_UpdateGenerator(generator);
+			}
+		}
+		ret = E_OK;
+	}
+	return ret;
+}
+#endif
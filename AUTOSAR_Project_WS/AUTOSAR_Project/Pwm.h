@@ -0,0 +1,238 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *              (M0PWM/M1PWM generators, the outputs are driven by the hardware)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef PWM_H
+#define PWM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define PWM_VENDOR_ID    (1000U)
+
+/* Pwm Module Id */
+#define PWM_MODULE_ID    (121U)
+
+/* Pwm Instance Id */
+#define PWM_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_SW_MAJOR_VERSION           (1U)
+#define PWM_SW_MINOR_VERSION           (0U)
+#define PWM_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_AR_RELEASE_MAJOR_VERSION   (4U)
+#define PWM_AR_RELEASE_MINOR_VERSION   (0U)
+#define PWM_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Pwm Status
+ */
+#define PWM_INITIALIZED                (1U)
+#define PWM_NOT_INITIALIZED            (0U)
+
+/* Duty cycle of an always active channel (0x8000 --> 100%) */
+#define PWM_DUTY_MAX                   (0x8000U)
+
+/* Signature of a valid output record in the .noinit RAM section */
+#define PWM_WARM_BOOT_SIGNATURE        (0x9D7AB007UL)
+
+/* Divider of the system clock feeding the PWM generators (RCC PWMDIV field) */
+#define PWM_CLOCK_DIV_2                (0U)
+#define PWM_CLOCK_DIV_4                (1U)
+#define PWM_CLOCK_DIV_8                (2U)
+#define PWM_CLOCK_DIV_16               (3U)
+#define PWM_CLOCK_DIV_32               (4U)
+#define PWM_CLOCK_DIV_64               (5U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Pwm Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Pwm Pre-Compile Configuration Header file */
+#include "Pwm_Cfg.h"
+
+/* AUTOSAR Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PWM_CFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (PWM_CFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION)\
+ ||  (PWM_CFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION)\
+ ||  (PWM_CFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+  #error "The SW version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Pwm Init */
+#define PWM_INIT_SID                         (uint8)0x00
+
+/* Service ID for Pwm Set Duty Cycle */
+#define PWM_SET_DUTY_CYCLE_SID               (uint8)0x02
+
+/* Service ID for Pwm Set Period And Duty */
+#define PWM_SET_PERIOD_AND_DUTY_SID          (uint8)0x03
+
+/* Service ID for Pwm Set Output To Idle */
+#define PWM_SET_OUTPUT_TO_IDLE_SID           (uint8)0x04
+
+/* Service ID for Pwm Disable Notification */
+#define PWM_DISABLE_NOTIFICATION_SID         (uint8)0x06
+
+/* Service ID for Pwm Enable Notification */
+#define PWM_ENABLE_NOTIFICATION_SID          (uint8)0x07
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Pwm_Init API service called with NULL pointer parameter */
+#define PWM_E_PARAM_CONFIG                   (uint8)0x10
+
+/* API service used without module initialization */
+#define PWM_E_UNINIT                         (uint8)0x11
+
+/* DET code to report Invalid Channel */
+#define PWM_E_PARAM_CHANNEL                  (uint8)0x12
+
+/* Pwm_SetPeriodAndDuty API service called on a channel with a fixed period */
+#define PWM_E_PERIOD_UNCHANGEABLE            (uint8)0x13
+
+/* Pwm_Init API service called while the module is already initialized */
+#define PWM_E_ALREADY_INITIALIZED            (uint8)0x14
+
+/* API service called with a duty cycle above PWM_DUTY_MAX */
+#define PWM_E_PARAM_DUTY                     (uint8)0x80
+
+/* Pwm_SetPeriodAndDuty API service called with a period of 0, the 16 bits counters take 1 .. 0xFFFF */
+#define PWM_E_PARAM_PERIOD                   (uint8)0x81
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the Pwm channels (index in Pwm_PBcfg.c) */
+typedef uint8 Pwm_ChannelType;
+
+/* Type definition for the period in PWM clock ticks, the generator counters are 16 bits */
+typedef uint16 Pwm_PeriodType;
+
+/* Type definition for the duty cycle (0 --> always inactive .. PWM_DUTY_MAX --> always active) */
+typedef uint16 Pwm_DutyCycleType;
+
+/* Type definition for the level of an output */
+typedef enum
+{
+	PWM_HIGH,PWM_LOW
+}Pwm_OutputStateType;
+
+/* Type definition for the edges of an output which call the channel notification */
+typedef enum
+{
+	PWM_RISING_EDGE,PWM_FALLING_EDGE,PWM_BOTH_EDGES
+}Pwm_EdgeNotificationType;
+
+/* Type definition for the class of a channel */
+typedef enum
+{
+	PWM_VARIABLE_PERIOD,PWM_FIXED_PERIOD
+}Pwm_ChannelClassType;
+
+/* Type definition for the hardware outputs: MnPWMk is output A (k even) or B (k odd) of generator k/2 of module n */
+typedef enum
+{
+	PWM_M0PWM0,PWM_M0PWM1,PWM_M0PWM2,PWM_M0PWM3,PWM_M0PWM4,PWM_M0PWM5,PWM_M0PWM6,PWM_M0PWM7,
+	PWM_M1PWM0,PWM_M1PWM1,PWM_M1PWM2,PWM_M1PWM3,PWM_M1PWM4,PWM_M1PWM5,PWM_M1PWM6,PWM_M1PWM7
+}Pwm_HwChannelType;
+
+typedef struct
+{
+	/* Member contains the hardware output of the channel */
+	Pwm_HwChannelType HwChannel;
+	/* Member contains the class of the channel, the outputs A and B of a generator share its period */
+	Pwm_ChannelClassType ChannelClass;
+	/* Member contains the period after Pwm_Init in PWM clock ticks at PWM_REFERENCE_CLOCK_HZ */
+	Pwm_PeriodType DefaultPeriod;
+	/* Member contains the duty cycle after Pwm_Init */
+	Pwm_DutyCycleType DefaultDutyCycle;
+	/* Member contains the level of the output during the active part of the period */
+	Pwm_OutputStateType Polarity;
+	/* Member contains the level of the output after Pwm_SetOutputToIdle */
+	Pwm_OutputStateType IdleState;
+	/* Member contains the function called on the enabled edges of the output (NULL_PTR if none) */
+	void (*Notification)(void);
+}Pwm_ConfigChannel;
+
+/* Data Structure required for initializing the Pwm Driver */
+typedef struct Pwm_ConfigType
+{
+	Pwm_ConfigChannel Channels[PWM_NUMBER_OF_CHANNELS];
+} Pwm_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for Pwm Initialization API */
+void Pwm_Init(const Pwm_ConfigType * ConfigPtr);
+
+/* Function for Pwm Set Duty Cycle API */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, Pwm_DutyCycleType DutyCycle);
+
+#if (PWM_SET_PERIOD_AND_DUTY_API == STD_ON)
+/* Function for Pwm Set Period And Duty API */
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, Pwm_DutyCycleType DutyCycle);
+#endif
+
+/* Function for Pwm Set Output To Idle API */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/* Function for Pwm Disable Notification API */
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber);
+
+/* Function for Pwm Enable Notification API */
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification);
+#endif
+
+/* Function called by Mcu after each change of the system clock frequency */
+void Pwm_ClockNotification(void);
+
+#if (PWM_WARM_BOOT_API == STD_ON)
+/* Function to set back the periods and duty cycles saved before a software or watchdog reset */
+Std_ReturnType Pwm_RestoreOutputs(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Pwm and other modules */
+extern const Pwm_ConfigType Pwm_Configuration;
+
+#endif /* PWM_H */
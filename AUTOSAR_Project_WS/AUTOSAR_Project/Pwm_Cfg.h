@@ -0,0 +1,59 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef PWM_CFG_H
+#define PWM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_CFG_SW_MAJOR_VERSION              (1U)
+#define PWM_CFG_SW_MINOR_VERSION              (0U)
+#define PWM_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PWM_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PWM_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define PWM_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Set Period And Duty API */
+#define PWM_SET_PERIOD_AND_DUTY_API         (STD_ON)
+
+/* Pre-compile option for the duty cycles kept in the .noinit RAM section for a warm boot (Pwm_RestoreOutputs) */
+#define PWM_WARM_BOOT_API                   (STD_ON)
+
+/* Pre-compile option for the edge notifications (generator interrupts installed by Irq_Register) */
+#define PWM_NOTIFICATION_SUPPORTED          (STD_ON)
+
+/* Priority of the generator interrupts */
+#define PWM_INTERRUPT_PRIORITY              (3U)
+
+/* Divider of the system clock feeding the generators: 80 MHz / 8 --> 10 MHz PWM clock */
+#define PWM_CLOCK_DIVIDER                   PWM_CLOCK_DIV_8
+
+/* System clock frequency of the configured periods, they are rescaled by Pwm_ClockNotification
+ * to keep the same output frequency with another system clock */
+#define PWM_REFERENCE_CLOCK_HZ              (80000000UL)
+
+/* Number of the configured Pwm Channels */
+#define PWM_NUMBER_OF_CHANNELS              (3U)
+
+/* Channel Index in the array of structures in Pwm_PBcfg.c */
+#define PwmConf_LED_RED_CHANNEL_ID_INDEX    (uint8)0x00
+#define PwmConf_LED_BLUE_CHANNEL_ID_INDEX   (uint8)0x01
+#define PwmConf_LED_GREEN_CHANNEL_ID_INDEX  (uint8)0x02
+
+#endif /* PWM_CFG_H */
@@ -0,0 +1,50 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Pwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_PBCFG_SW_MAJOR_VERSION              (1U)
+#define PWM_PBCFG_SW_MINOR_VERSION              (0U)
+#define PWM_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PWM_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PWM_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PWM_PBCFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (PWM_PBCFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION)\
+ ||  (PWM_PBCFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION)\
+ ||  (PWM_PBCFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+
+/* PB structure used with Pwm_Init API --> Hardware output, Class, Default period (10 MHz PWM clock ticks),
+ *                                         Default duty cycle, Polarity, Idle state, Notification
+ * The RGB LED pins are M1PWM5 (PF1), M1PWM6 (PF2) and M1PWM7 (PF3), the blue and green LEDs share generator 3 */
+const Pwm_ConfigType Pwm_Configuration = {
+                                             PWM_M1PWM5,PWM_VARIABLE_PERIOD,10000,0,PWM_HIGH,PWM_LOW,NULL_PTR,   /* Red LED   PF1 1 kHz */
+                                             PWM_M1PWM6,PWM_FIXED_PERIOD,10000,0,PWM_HIGH,PWM_LOW,NULL_PTR,      /* Blue LED  PF2 1 kHz */
+                                             PWM_M1PWM7,PWM_FIXED_PERIOD,10000,0,PWM_HIGH,PWM_LOW,NULL_PTR       /* Green LED PF3 1 kHz */
+                                         };
@@ -0,0 +1,75 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Pwm Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef PWM_REGS_H
+#define PWM_REGS_H
+
+#include "Std_Types.h"
+
+/* PWM modules base addresses */
+#define PWM_MODULE0_BASE_ADDRESS          0x40028000
+#define PWM_MODULE1_BASE_ADDRESS          0x40029000
+
+/* PWM module Registers offset addresses */
+#define PWM_CTL_REG_OFFSET                0x000     /* Master Control (GLOBALSYNCn bits 3:0) */
+#define PWM_ENABLE_REG_OFFSET             0x008     /* Output Enable */
+#define PWM_INTEN_REG_OFFSET              0x014     /* Interrupt Enable (INTPWMn bits 3:0) */
+
+/* PWM generator n Registers offset addresses (from the module base address) */
+#define PWM_GEN_OFFSET(GEN)               (0x040 + ((uint32)(GEN) * 0x040))
+#define PWM_GEN_CTL_REG_OFFSET            0x000     /* Generator Control */
+#define PWM_GEN_INTEN_REG_OFFSET          0x004     /* Interrupt and Trigger Enable */
+#define PWM_GEN_ISC_REG_OFFSET            0x00C     /* Interrupt Status and Clear */
+#define PWM_GEN_LOAD_REG_OFFSET           0x010     /* Load (counter start in count-down mode) */
+#define PWM_GEN_CMPA_REG_OFFSET           0x018     /* Compare A */
+#define PWM_GEN_CMPB_REG_OFFSET           0x01C     /* Compare B */
+#define PWM_GEN_GENA_REG_OFFSET           0x020     /* Output A actions */
+#define PWM_GEN_GENB_REG_OFFSET           0x024     /* Output B actions */
+
+/* Access a PWM module register */
+#define PWM_REG(BASE,OFFSET)              (*((volatile uint32 *)((BASE) + (OFFSET))))
+
+/* Access a PWM generator register */
+#define PWM_GEN_REG(BASE,GEN,OFFSET)      (*((volatile uint32 *)((BASE) + PWM_GEN_OFFSET(GEN) + (OFFSET))))
+
+/* Generator Control bits: count-down mode (MODE = 0), the load, compare and output actions
+ * are globally synchronized --> applied at the counter zero after the GLOBALSYNCn bit is set */
+#define PWM_GEN_CTL_ENABLE                0x00000001
+#define PWM_GEN_CTL_LOADUPD               0x00000008
+#define PWM_GEN_CTL_CMPAUPD               0x00000010
+#define PWM_GEN_CTL_CMPBUPD               0x00000020
+#define PWM_GEN_CTL_GENAUPD_GLOBAL        0x000000C0
+#define PWM_GEN_CTL_GENBUPD_GLOBAL        0x00000300
+
+/* Generator interrupt events */
+#define PWM_GEN_INT_CNTLOAD               0x00000002
+#define PWM_GEN_INT_CMPAD                 0x00000008
+#define PWM_GEN_INT_CMPBD                 0x00000020
+
+/* Output actions of the PWMnGENA/PWMnGENB registers (2 bits per event) */
+#define PWM_GEN_ACT_LOW                   (2U)
+#define PWM_GEN_ACT_HIGH                  (3U)
+#define PWM_GEN_ACTZERO_POS               (0U)
+#define PWM_GEN_ACTLOAD_POS               (2U)
+#define PWM_GEN_ACTCMPAD_POS              (6U)
+#define PWM_GEN_ACTCMPBD_POS              (10U)
+
+/* PWM module clock gating control and peripheral ready registers */
+#define PWM_SYSCTL_RCGCPWM_REG            (*((volatile uint32 *)0x400FE640))
+#define PWM_SYSCTL_PRPWM_REG              (*((volatile uint32 *)0x400FEA40))
+
+/* Run-mode clock configuration register: PWM clock divider */
+#define PWM_SYSCTL_RCC_REG                (*((volatile uint32 *)0x400FE060))
+#define PWM_RCC_USEPWMDIV_BIT             (20U)
+#define PWM_RCC_PWMDIV_POS                (17U)
+#define PWM_RCC_PWMDIV_MASK               0x000E0000
+
+#endif /* PWM_REGS_H */
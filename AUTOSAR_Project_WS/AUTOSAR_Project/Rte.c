@@ -0,0 +1,19 @@
+ /******************************************************************************
+ *
+ * Module: Rte
+ *
+ * File Name: Rte.c
+ *
+ * Description: Signal buffers between the tasks generated by Tools/Rte_Gen,
+ *              do not edit ... update Rte_Gen_Ports.txt and run the tool again.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Rte.h"
+
+/* Signal buffers with their initial value and the data-changed flag of each reader */
+volatile boolean Rte_Buffer_LedState = FALSE;
+volatile boolean Rte_Changed_LedState[1] = {FALSE};
+volatile uint8 Rte_Buffer_LedBrightness = LED_BRIGHTNESS_DEFAULT;
+volatile boolean Rte_Changed_LedBrightness[1] = {FALSE};
@@ -0,0 +1,88 @@
+ /******************************************************************************
+ *
+ * Module: Rte
+ *
+ * File Name: Rte.h
+ *
+ * Description: Signal buffers and accessors between the tasks generated by Tools/Rte_Gen,
+ *              do not edit ... update Rte_Gen_Ports.txt and run the tool again.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef RTE_H
+#define RTE_H
+
+#include "Std_Types.h"
+#include "Led.h"
+
+/* Status returned by the Rte accessors */
+#define RTE_E_OK                ((Std_ReturnType)0x00U)
+
+/*******************************************************************************
+ *                      Signal Buffers (Rte.c)                                 *
+ *******************************************************************************/
+
+/* LedState: App.LedState --> Led.State */
+extern volatile boolean Rte_Buffer_LedState;
+extern volatile boolean Rte_Changed_LedState[1];
+
+/* LedBrightness: App.LedBrightness --> Led.Brightness */
+extern volatile uint8 Rte_Buffer_LedBrightness;
+extern volatile boolean Rte_Changed_LedBrightness[1];
+
+/*******************************************************************************
+ *                      Accessors                                              *
+ *******************************************************************************/
+
+/* Description: Write LedState from App, the readers see it as changed if the value is new */
+LOCAL_INLINE Std_ReturnType Rte_Write_App_LedState(boolean Data)
+{
+    if(Rte_Buffer_LedState != Data)
+    {
+        Rte_Buffer_LedState = Data;
+        Rte_Changed_LedState[0] = TRUE;
+    }
+    return RTE_E_OK;
+}
+
+/* Description: Write LedBrightness from App, the readers see it as changed if the value is new */
+LOCAL_INLINE Std_ReturnType Rte_Write_App_LedBrightness(uint8 Data)
+{
+    if(Rte_Buffer_LedBrightness != Data)
+    {
+        Rte_Buffer_LedBrightness = Data;
+        Rte_Changed_LedBrightness[0] = TRUE;
+    }
+    return RTE_E_OK;
+}
+
+/* Description: Read LedState in Led and clear its data-changed flag */
+LOCAL_INLINE Std_ReturnType Rte_Read_Led_State(boolean * Data)
+{
+    Rte_Changed_LedState[0] = FALSE;
+    *Data = Rte_Buffer_LedState;
+    return RTE_E_OK;
+}
+
+/* Description: TRUE if LedState changed since its last read in Led */
+LOCAL_INLINE boolean Rte_IsUpdated_Led_State(void)
+{
+    return Rte_Changed_LedState[0];
+}
+
+/* Description: Read LedBrightness in Led and clear its data-changed flag */
+LOCAL_INLINE Std_ReturnType Rte_Read_Led_Brightness(uint8 * Data)
+{
+    Rte_Changed_LedBrightness[0] = FALSE;
+    *Data = Rte_Buffer_LedBrightness;
+    return RTE_E_OK;
+}
+
+/* Description: TRUE if LedBrightness changed since its last read in Led */
+LOCAL_INLINE boolean Rte_IsUpdated_Led_Brightness(void)
+{
+    return Rte_Changed_LedBrightness[0];
+}
+
+#endif /* RTE_H */
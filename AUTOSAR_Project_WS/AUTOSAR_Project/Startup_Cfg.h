@@ -0,0 +1,27 @@
+ /******************************************************************************
+ *
+ * Module: Startup
+ *
+ * File Name: Startup_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file of the reset handler in tm4c123gh6pm_startup_ccs.c,
+ *              it is also included by the linker command file tm4c123gh6pm.cmd
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef STARTUP_CFG_H
+#define STARTUP_CFG_H
+
+/*
+ * Pre-compile option for the fast startup:
+ *  1 --> ResetISR initializes .data and .bss with 16-byte block copies and calls main directly
+ *  0 --> ResetISR jumps to _c_int00 which does the table driven initialization of the run time library
+ * Plain numbers are used as the linker reads this file too, the build can override it with
+ * --define=FAST_STARTUP=1 given to both the compiler and the linker.
+ */
+#ifndef FAST_STARTUP
+#define FAST_STARTUP                0
+#endif
+
+#endif /* STARTUP_CFG_H */
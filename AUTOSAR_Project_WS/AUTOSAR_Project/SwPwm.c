@@ -0,0 +1,343 @@
+ /******************************************************************************
+ *
+ * Module: SwPwm
+ *
+ * File Name: SwPwm.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Software PWM Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "SwPwm.h"
+#include "SwPwm_Regs.h"
+#include "Gpt.h"
+#include "Mcu.h"
+
+#if (SWPWM_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and SwPwm Modules */
+#if ((DET_AR_MAJOR_VERSION != SWPWM_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != SWPWM_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != SWPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Number of the edges of a period: the period start then at most one edge per channel */
+#define SWPWM_MAX_EDGES    (SWPWM_NUMBER_OF_CHANNELS + 1U)
+
+/* Base address of each GPIO Port ordered by Port Id */
+STATIC const uint32 SwPwm_PortBaseAddress[DIO_NUMBER_OF_PORTS] = {
+                                                                     SWPWM_GPIO_PORTA_BASE_ADDRESS, SWPWM_GPIO_PORTB_BASE_ADDRESS,
+                                                                     SWPWM_GPIO_PORTC_BASE_ADDRESS, SWPWM_GPIO_PORTD_BASE_ADDRESS,
+                                                                     SWPWM_GPIO_PORTE_BASE_ADDRESS, SWPWM_GPIO_PORTF_BASE_ADDRESS
+                                                                 };
+
+/* Description: Structure of an edge of the period:
+ *  1. the time of the edge in system clock ticks from the period start
+ *  2. the ports changed by the edge (bit p --> Dio Port p)
+ *  3. the pins changed in each port (the GPIODATA address mask)
+ *  4. the levels written to these pins
+ */
+typedef struct
+{
+	uint32 Time;
+	uint8 Ports;
+	uint8 Pins[DIO_NUMBER_OF_PORTS];
+	uint8 Levels[DIO_NUMBER_OF_PORTS];
+}SwPwm_EdgeType;
+
+/* Description: Structure of the edges of a period sorted by time, edge 0 is the period start
+ *              which sets the active level of the channels with a duty cycle above 0 */
+typedef struct
+{
+	uint32 Period;
+	uint8 NumberOfEdges;
+	SwPwm_EdgeType Edges[SWPWM_MAX_EDGES];
+}SwPwm_ScheduleType;
+
+STATIC const SwPwm_ConfigChannel * SwPwm_Channels = NULL_PTR;
+STATIC uint8 SwPwm_Status = SWPWM_NOT_INITIALIZED;
+
+/* Duty cycle of each channel */
+STATIC SwPwm_DutyCycleType SwPwm_DutyCycle[SWPWM_NUMBER_OF_CHANNELS];
+
+/* Two schedules: the one used by the timer interrupt and the one built by SwPwm_SetDutyCycle, the timer
+ * interrupt switches to the new one at the next period start when it is ready */
+STATIC SwPwm_ScheduleType SwPwm_Schedules[2];
+STATIC volatile uint8 SwPwm_ActiveSchedule = 0;
+STATIC volatile boolean SwPwm_ScheduleReady = FALSE;
+
+/* Next edge applied by the timer interrupt */
+STATIC uint8 SwPwm_EdgeIndex = 0;
+
+/************************************************************************************
+* Description: Build the schedule of the next periods from the duty cycles in the schedule
+*              not used by the timer interrupt, the off edges are sorted by insertion and
+*              the channels switching off at the same time share an edge
+************************************************************************************/
+STATIC void SwPwm_BuildSchedule(void)
+{
+	SwPwm_ScheduleType * schedule;
+	SwPwm_EdgeType * edge;
+	SwPwm_ChannelType channel;
+	SwPwm_DutyCycleType duty;
+	uint32 time;
+	uint8 port;
+	uint8 pin;
+	uint8 index;
+	uint8 count = 1;
+
+	/* The timer interrupt keeps its schedule while this one is built */
+	SwPwm_ScheduleReady = FALSE;
+	schedule = &SwPwm_Schedules[SwPwm_ActiveSchedule ^ 1U];
+
+	schedule->Period = Mcu_GetSysClockFrequency() / SWPWM_FREQUENCY_HZ;
+	schedule->Edges[0].Time  = 0;
+	schedule->Edges[0].Ports = 0;
+	for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		schedule->Edges[0].Pins[port]   = 0;
+		schedule->Edges[0].Levels[port] = 0;
+	}
+
+	for(channel = 0; channel < SWPWM_NUMBER_OF_CHANNELS; channel++)
+	{
+		duty = SwPwm_DutyCycle[channel];
+		if(duty != 0)
+		{
+			port = SwPwm_Channels[channel].Port;
+			pin  = (uint8)(1U << SwPwm_Channels[channel].Pin);
+
+			/* Active from the period start */
+			schedule->Edges[0].Ports |= (uint8)(1U << port);
+			schedule->Edges[0].Pins[port] |= pin;
+			if(STD_HIGH == SwPwm_Channels[channel].ActiveLevel)
+			{
+				schedule->Edges[0].Levels[port] |= pin;
+			}
+
+			/* Inactive from its duty cycle time */
+			if(duty < SWPWM_DUTY_MAX)
+			{
+				time = (schedule->Period * duty) / SWPWM_DUTY_MAX;
+
+				/* First edge at or after this time */
+				for(index = 1; (index < count) && (schedule->Edges[index].Time < time); index++)
+				{
+				}
+				edge = &schedule->Edges[index];
+
+				if((index == count) || (edge->Time != time))
+				{
+					/* New edge, the later ones move up */
+					for(index = count; &schedule->Edges[index] != edge; index--)
+					{
+						schedule->Edges[index] = schedule->Edges[index - 1U];
+					}
+					edge->Time  = time;
+					edge->Ports = 0;
+					for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+					{
+						edge->Pins[index]   = 0;
+						edge->Levels[index] = 0;
+					}
+					count++;
+				}
+
+				edge->Ports |= (uint8)(1U << port);
+				edge->Pins[port] |= pin;
+				if(STD_LOW == SwPwm_Channels[channel].ActiveLevel)
+				{
+					edge->Levels[port] |= pin;
+				}
+			}
+		}
+	}
+
+	schedule->NumberOfEdges = count;
+	SwPwm_ScheduleReady = TRUE;
+}
+
+/************************************************************************************
+* Service Name: SwPwm_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the SwPwm module:
+*              - Set the duty cycle of all the channels to 0 (the pins keep their Port level)
+*              - Start the Gpt channel for the first period
+*              The channel pins are configured as digital outputs by the Port Driver and
+*              the Gpt Driver must be initialized before.
+************************************************************************************/
+void SwPwm_Init(const SwPwm_ConfigType * ConfigPtr)
+{
+	SwPwm_ChannelType channel;
+
+#if (SWPWM_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(SWPWM_MODULE_ID, SWPWM_INSTANCE_ID, SWPWM_INIT_SID,
+		     SWPWM_E_PARAM_CONFIG);
+	}
+	else if (SWPWM_INITIALIZED == SwPwm_Status)
+	{
+		Det_ReportError(SWPWM_MODULE_ID, SWPWM_INSTANCE_ID, SWPWM_INIT_SID,
+		     SWPWM_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		SwPwm_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		for(channel = 0; channel < SWPWM_NUMBER_OF_CHANNELS; channel++)
+		{
+			SwPwm_DutyCycle[channel] = 0;
+		}
+
+		SwPwm_ActiveSchedule = 0;
+		SwPwm_BuildSchedule();
+		SwPwm_ActiveSchedule = 1;
+		SwPwm_ScheduleReady  = FALSE;
+		SwPwm_EdgeIndex = 0;
+
+		SwPwm_Status = SWPWM_INITIALIZED;
+
+		Gpt_EnableNotification(SWPWM_GPT_CHANNEL);
+		Gpt_StartTimer(SWPWM_GPT_CHANNEL, SwPwm_Schedules[SwPwm_ActiveSchedule].Period);
+	}
+}
+
+/************************************************************************************
+* Service Name: SwPwm_SetDutyCycle
+* Service ID[hex]: 0x02
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Numeric identifier of the SwPwm channel
+*                  DutyCycle - 0 (always inactive) .. SWPWM_DUTY_MAX (always active)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel, the edges of the period are sorted
+*              again and the new duty cycles are applied from the next period start.
+************************************************************************************/
+void SwPwm_SetDutyCycle(SwPwm_ChannelType ChannelNumber, SwPwm_DutyCycleType DutyCycle)
+{
+	boolean error = FALSE;
+
+#if (SWPWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (SWPWM_NOT_INITIALIZED == SwPwm_Status)
+	{
+		Det_ReportError(SWPWM_MODULE_ID, SWPWM_INSTANCE_ID,
+				SWPWM_SET_DUTY_CYCLE_SID, SWPWM_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (SWPWM_NUMBER_OF_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(SWPWM_MODULE_ID, SWPWM_INSTANCE_ID,
+				SWPWM_SET_DUTY_CYCLE_SID, SWPWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else if (SWPWM_DUTY_MAX < DutyCycle)
+	{
+		Det_ReportError(SWPWM_MODULE_ID, SWPWM_INSTANCE_ID,
+				SWPWM_SET_DUTY_CYCLE_SID, SWPWM_E_PARAM_DUTY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && (SwPwm_DutyCycle[ChannelNumber] != DutyCycle))
+	{
+		SwPwm_DutyCycle[ChannelNumber] = DutyCycle;
+		SwPwm_BuildSchedule();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: SwPwm_TimerNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Gpt notification called at each edge time: write the pins of the edge with one
+*              masked GPIODATA store per port, then start the Gpt channel for the next edge.
+*              A new schedule is taken at the period start only.
+************************************************************************************/
+void SwPwm_TimerNotification(void)
+{
+	const SwPwm_ScheduleType * schedule;
+	const SwPwm_EdgeType * edge;
+	uint8 ports;
+	uint8 port;
+	uint32 delay;
+
+	if((0U == SwPwm_EdgeIndex) && (TRUE == SwPwm_ScheduleReady))
+	{
+		SwPwm_ActiveSchedule ^= 1U;
+		SwPwm_ScheduleReady = FALSE;
+	}
+
+	schedule = &SwPwm_Schedules[SwPwm_ActiveSchedule];
+	edge = &schedule->Edges[SwPwm_EdgeIndex];
+
+	for(ports = edge->Ports, port = 0; ports != 0; ports >>= 1, port++)
+	{
+		if(ports & 1U)
+		{
+			SWPWM_GPIO_DATA_MASKED(SwPwm_PortBaseAddress[port], edge->Pins[port]) = edge->Levels[port];
+		}
+	}
+
+	SwPwm_EdgeIndex++;
+	if(SwPwm_EdgeIndex < schedule->NumberOfEdges)
+	{
+		delay = schedule->Edges[SwPwm_EdgeIndex].Time - edge->Time;
+	}
+	else
+	{
+		delay = schedule->Period - edge->Time;
+		SwPwm_EdgeIndex = 0;
+	}
+
+	Gpt_StartTimer(SWPWM_GPT_CHANNEL, delay);
+}
+
+/************************************************************************************
+* Service Name: SwPwm_ClockNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by Mcu after each change of the system clock frequency,
+*              the edge times are computed again from the new frequency.
+************************************************************************************/
+void SwPwm_ClockNotification(void)
+{
+	if(SWPWM_INITIALIZED == SwPwm_Status)
+	{
+		SwPwm_BuildSchedule();
+	}
+}
@@ -0,0 +1,153 @@
+ /******************************************************************************
+ *
+ * Module: SwPwm
+ *
+ * File Name: SwPwm.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Software PWM Driver
+ *              (PWM on any GPIO output pins from the edges of a Gpt one-shot channel)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SWPWM_H
+#define SWPWM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define SWPWM_VENDOR_ID    (1000U)
+
+/* SwPwm Module Id (Complex Driver) */
+#define SWPWM_MODULE_ID    (253U)
+
+/* SwPwm Instance Id */
+#define SWPWM_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define SWPWM_SW_MAJOR_VERSION           (1U)
+#define SWPWM_SW_MINOR_VERSION           (0U)
+#define SWPWM_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define SWPWM_AR_RELEASE_MAJOR_VERSION   (4U)
+#define SWPWM_AR_RELEASE_MINOR_VERSION   (0U)
+#define SWPWM_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for SwPwm Status
+ */
+#define SWPWM_INITIALIZED                (1U)
+#define SWPWM_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and SwPwm Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != SWPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != SWPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != SWPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* SwPwm Pre-Compile Configuration Header file */
+#include "SwPwm_Cfg.h"
+
+/* AUTOSAR Version checking between SwPwm_Cfg.h and SwPwm.h files */
+#if ((SWPWM_CFG_AR_RELEASE_MAJOR_VERSION != SWPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SWPWM_CFG_AR_RELEASE_MINOR_VERSION != SWPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (SWPWM_CFG_AR_RELEASE_PATCH_VERSION != SWPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of SwPwm_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between SwPwm_Cfg.h and SwPwm.h files */
+#if ((SWPWM_CFG_SW_MAJOR_VERSION != SWPWM_SW_MAJOR_VERSION)\
+ ||  (SWPWM_CFG_SW_MINOR_VERSION != SWPWM_SW_MINOR_VERSION)\
+ ||  (SWPWM_CFG_SW_PATCH_VERSION != SWPWM_SW_PATCH_VERSION))
+  #error "The SW version of SwPwm_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+#include "Dio.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for SwPwm Init */
+#define SWPWM_INIT_SID                       (uint8)0x00
+
+/* Service ID for SwPwm Set Duty Cycle */
+#define SWPWM_SET_DUTY_CYCLE_SID             (uint8)0x02
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* SwPwm_Init API service called with NULL pointer parameter */
+#define SWPWM_E_PARAM_CONFIG                 (uint8)0x10
+
+/* API service used without module initialization */
+#define SWPWM_E_UNINIT                       (uint8)0x11
+
+/* DET code to report Invalid Channel */
+#define SWPWM_E_PARAM_CHANNEL                (uint8)0x12
+
+/* SwPwm_SetDutyCycle API service called with a duty cycle above SWPWM_DUTY_MAX */
+#define SWPWM_E_PARAM_DUTY                   (uint8)0x13
+
+/* SwPwm_Init API service called while the module is already initialized */
+#define SWPWM_E_ALREADY_INITIALIZED          (uint8)0x14
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the SwPwm channels (index in SwPwm_PBcfg.c) */
+typedef uint8 SwPwm_ChannelType;
+
+/* Type definition for the duty cycle (0 --> always inactive .. SWPWM_DUTY_MAX --> always active) */
+typedef uint16 SwPwm_DutyCycleType;
+
+typedef struct
+{
+	/* Member contains the Dio Port of the channel pin */
+	Dio_PortType Port;
+	/* Member contains the pin number in the port */
+	Dio_ChannelType Pin;
+	/* Member contains the level of the pin during the active part of the period */
+	Dio_LevelType ActiveLevel;
+}SwPwm_ConfigChannel;
+
+/* Data Structure required for initializing the SwPwm Driver */
+typedef struct SwPwm_ConfigType
+{
+	SwPwm_ConfigChannel Channels[SWPWM_NUMBER_OF_CHANNELS];
+} SwPwm_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for SwPwm Initialization API */
+void SwPwm_Init(const SwPwm_ConfigType * ConfigPtr);
+
+/* Function for SwPwm Set Duty Cycle API */
+void SwPwm_SetDutyCycle(SwPwm_ChannelType ChannelNumber, SwPwm_DutyCycleType DutyCycle);
+
+/* Gpt notification of the SwPwm channel, it applies the next edge of the period */
+void SwPwm_TimerNotification(void);
+
+/* Function called by Mcu after each change of the system clock frequency */
+void SwPwm_ClockNotification(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by SwPwm and other modules */
+extern const SwPwm_ConfigType SwPwm_Configuration;
+
+#endif /* SWPWM_H */
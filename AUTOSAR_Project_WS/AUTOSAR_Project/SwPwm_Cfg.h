@@ -0,0 +1,49 @@
+ /******************************************************************************
+ *
+ * Module: SwPwm
+ *
+ * File Name: SwPwm_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Software PWM Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SWPWM_CFG_H
+#define SWPWM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SWPWM_CFG_SW_MAJOR_VERSION              (1U)
+#define SWPWM_CFG_SW_MINOR_VERSION              (0U)
+#define SWPWM_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define SWPWM_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SWPWM_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define SWPWM_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define SWPWM_DEV_ERROR_DETECT                (STD_ON)
+
+/* Gpt one-shot channel which times the edges, it counts the system clock */
+#define SWPWM_GPT_CHANNEL                     GptConf_SWPWM_CHANNEL_ID_INDEX
+
+/* Frequency of the PWM periods, the same for all the channels */
+#define SWPWM_FREQUENCY_HZ                    (200UL)
+
+/* Duty cycle of an always active channel (resolution of the duty cycle) */
+#define SWPWM_DUTY_MAX                        (255U)
+
+/* Number of the configured SwPwm Channels */
+#define SWPWM_NUMBER_OF_CHANNELS              (3U)
+
+/* Channel Index in the array of structures in SwPwm_PBcfg.c */
+#define SwPwmConf_LED_RED_CHANNEL_ID_INDEX    (uint8)0x00
+#define SwPwmConf_LED_BLUE_CHANNEL_ID_INDEX   (uint8)0x01
+#define SwPwmConf_LED_GREEN_CHANNEL_ID_INDEX  (uint8)0x02
+
+#endif /* SWPWM_CFG_H */
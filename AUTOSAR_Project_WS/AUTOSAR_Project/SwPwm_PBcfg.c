@@ -0,0 +1,47 @@
+ /******************************************************************************
+ *
+ * Module: SwPwm
+ *
+ * File Name: SwPwm_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Software PWM Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "SwPwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define SWPWM_PBCFG_SW_MAJOR_VERSION              (1U)
+#define SWPWM_PBCFG_SW_MINOR_VERSION              (0U)
+#define SWPWM_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define SWPWM_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SWPWM_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define SWPWM_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between SwPwm_PBcfg.c and SwPwm.h files */
+#if ((SWPWM_PBCFG_AR_RELEASE_MAJOR_VERSION != SWPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SWPWM_PBCFG_AR_RELEASE_MINOR_VERSION != SWPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (SWPWM_PBCFG_AR_RELEASE_PATCH_VERSION != SWPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between SwPwm_PBcfg.c and SwPwm.h files */
+#if ((SWPWM_PBCFG_SW_MAJOR_VERSION != SWPWM_SW_MAJOR_VERSION)\
+ ||  (SWPWM_PBCFG_SW_MINOR_VERSION != SWPWM_SW_MINOR_VERSION)\
+ ||  (SWPWM_PBCFG_SW_PATCH_VERSION != SWPWM_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with SwPwm_Init API --> Port, Pin, Active level */
+const SwPwm_ConfigType SwPwm_Configuration = {
+                                                 DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,STD_HIGH,   /* Red LED   PF1 */
+                                                 DioConf_LED1_PORT_NUM,2,STD_HIGH,                          /* Blue LED  PF2 */
+                                                 DioConf_LED1_PORT_NUM,3,STD_HIGH                           /* Green LED PF3 */
+                                             };
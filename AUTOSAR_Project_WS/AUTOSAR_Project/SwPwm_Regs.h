@@ -0,0 +1,29 @@
+ /******************************************************************************
+ *
+ * Module: SwPwm
+ *
+ * File Name: SwPwm_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Software PWM Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SWPWM_REGS_H
+#define SWPWM_REGS_H
+
+#include "Std_Types.h"
+
+/* GPIO Registers base addresses */
+#define SWPWM_GPIO_PORTA_BASE_ADDRESS       0x40004000
+#define SWPWM_GPIO_PORTB_BASE_ADDRESS       0x40005000
+#define SWPWM_GPIO_PORTC_BASE_ADDRESS       0x40006000
+#define SWPWM_GPIO_PORTD_BASE_ADDRESS       0x40007000
+#define SWPWM_GPIO_PORTE_BASE_ADDRESS       0x40024000
+#define SWPWM_GPIO_PORTF_BASE_ADDRESS       0x40025000
+
+/* GPIODATA seen through the address mask: address bits 9:2 select the pins changed by a write,
+ * the other pins of the port keep their level without a read-modify-write */
+#define SWPWM_GPIO_DATA_MASKED(BASE,MASK)   (*((volatile uint32 *)((BASE) + ((uint32)(MASK) << 2))))
+
+#endif /* SWPWM_REGS_H */
@@ -0,0 +1,619 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Uart Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Uart.h"
+#include "Uart_Regs.h"
+#include "Mcu.h"
+#include "Os.h"
+#include "Irq.h"
+
+#if ((UART_TX_BUFFER_SIZE == 0U) || ((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1U)) != 0U))
+  #error "UART_TX_BUFFER_SIZE must be a power of 2 (the ring indexes are free running)"
+#endif
+
+#if ((UART_RX_BUFFER_SIZE == 0U) || ((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1U)) != 0U))
+  #error "UART_RX_BUFFER_SIZE must be a power of 2 (the ring indexes are free running)"
+#endif
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Uart Modules */
+#if ((DET_AR_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Number of the UART modules */
+#define UART_NUMBER_OF_HW_UNITS     (8U)
+
+/* UART module with no configured channel */
+#define UART_NO_CHANNEL             (0xFFU)
+
+/* Description: Transmit and receive rings of a channel, each one has a single producer and a single consumer:
+ *  1. TxHead is only written by Uart_Write, TxTail by the transmit interrupt (or by Uart_Write while
+ *     the transmit interrupt is masked to start a transmission)
+ *  2. RxHead is only written by the receive interrupts, RxTail by Uart_Read
+ * The indexes are free running, the number of bytes in a ring is (Head - Tail) and a byte is at
+ * (index & (SIZE - 1)). A producer writes its bytes before it moves its index, so no lock is needed.
+ */
+typedef struct
+{
+	uint8 Tx[UART_TX_BUFFER_SIZE];
+	uint8 Rx[UART_RX_BUFFER_SIZE];
+	volatile uint16 TxHead;
+	volatile uint16 TxTail;
+	volatile uint16 RxHead;
+	volatile uint16 RxTail;
+}Uart_BufferType;
+
+/* Base address of each UART module */
+STATIC const uint32 Uart_BaseAddress[UART_NUMBER_OF_HW_UNITS] = {
+                                                                   UART_HW0_BASE_ADDRESS, UART_HW1_BASE_ADDRESS,
+                                                                   UART_HW2_BASE_ADDRESS, UART_HW3_BASE_ADDRESS,
+                                                                   UART_HW4_BASE_ADDRESS, UART_HW5_BASE_ADDRESS,
+                                                                   UART_HW6_BASE_ADDRESS, UART_HW7_BASE_ADDRESS
+                                                               };
+
+/* Peripheral interrupt of each UART module */
+STATIC const Irq_NumberType Uart_HwIrq[UART_NUMBER_OF_HW_UNITS] = { 5U, 6U, 33U, 59U, 60U, 61U, 62U, 63U };
+
+STATIC const Uart_ConfigChannel * Uart_Channels = NULL_PTR;
+STATIC uint8 Uart_Status = UART_NOT_INITIALIZED;
+
+/* Channel configured on each UART module */
+STATIC uint8 Uart_HwChannels[UART_NUMBER_OF_HW_UNITS];
+
+/* Rings of each channel */
+STATIC Uart_BufferType Uart_Buffers[UART_NUMBER_OF_CHANNELS];
+
+/************************************************************************************
+* Description: Write the baud rate divisor of a channel for the current system clock then its line
+*              control, the LCRH write latches the divisor. The UART must be disabled.
+*              Divisor = clock / (16 * baud rate) in 1/64 units rounded to the nearest.
+************************************************************************************/
+STATIC void Uart_SetLine(Uart_ChannelType Channel)
+{
+	const Uart_ConfigChannel * config = &Uart_Channels[Channel];
+	uint32 base = Uart_BaseAddress[config->HwUnit];
+	uint32 divisor = ((Mcu_GetSysClockFrequency() * 8U) / config->BaudRate + 1U) / 2U;
+	uint32 line = UART_LCRH_FEN | ((uint32)(config->DataBits - 5U) << UART_LCRH_WLEN_POS);
+
+	if(UART_PARITY_EVEN == config->Parity)
+	{
+		line |= UART_LCRH_PEN | UART_LCRH_EPS;
+	}
+	else if(UART_PARITY_ODD == config->Parity)
+	{
+		line |= UART_LCRH_PEN;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	if(2U == config->StopBits)
+	{
+		line |= UART_LCRH_STP2;
+	}
+
+	UART_REG(base, UART_IBRD_REG_OFFSET) = divisor >> 6;
+	UART_REG(base, UART_FBRD_REG_OFFSET) = divisor & 0x3FU;
+	UART_REG(base, UART_LCRH_REG_OFFSET) = line;
+}
+
+/************************************************************************************
+* Description: Move bytes from the transmit ring to the TX FIFO until the FIFO is full or the
+*              ring is empty, TxTail is written once after the burst
+************************************************************************************/
+STATIC void Uart_FillTxFifo(Uart_ChannelType Channel)
+{
+	Uart_BufferType * buffer = &Uart_Buffers[Channel];
+	uint32 base = Uart_BaseAddress[Uart_Channels[Channel].HwUnit];
+	uint16 head = buffer->TxHead;
+	uint16 tail = buffer->TxTail;
+
+	while((tail != head) && (0U == (UART_REG(base, UART_FR_REG_OFFSET) & UART_FR_TXFF)))
+	{
+		UART_REG(base, UART_DR_REG_OFFSET) = buffer->Tx[tail & (UART_TX_BUFFER_SIZE - 1U)];
+		tail++;
+	}
+	buffer->TxTail = tail;
+}
+
+/************************************************************************************
+* Description: Move all the bytes of the RX FIFO to the receive ring, RxHead is written once after
+*              the burst. The bytes received with an error or without space in the ring are dropped
+*              so the FIFO is always emptied and the interrupt is not raised again for them.
+************************************************************************************/
+STATIC void Uart_DrainRxFifo(Uart_ChannelType Channel)
+{
+	Uart_BufferType * buffer = &Uart_Buffers[Channel];
+	uint32 base = Uart_BaseAddress[Uart_Channels[Channel].HwUnit];
+	uint16 head = buffer->RxHead;
+	uint16 tail = buffer->RxTail;
+	uint16 received = head;
+	boolean overflow = FALSE;
+	boolean lineError = FALSE;
+	uint32 data;
+
+	while(0U == (UART_REG(base, UART_FR_REG_OFFSET) & UART_FR_RXFE))
+	{
+		data = UART_REG(base, UART_DR_REG_OFFSET);
+		if(0U != (data & UART_DR_ERROR_MASK))
+		{
+			lineError = TRUE;
+		}
+		else if((uint16)(head - tail) >= UART_RX_BUFFER_SIZE)
+		{
+			overflow = TRUE;
+		}
+		else
+		{
+			buffer->Rx[head & (UART_RX_BUFFER_SIZE - 1U)] = (uint8)data;
+			head++;
+		}
+	}
+	buffer->RxHead = head;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	if(TRUE == overflow)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_ISR_SID, UART_E_RX_OVERFLOW);
+	}
+	if(TRUE == lineError)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_ISR_SID, UART_E_RX_LINE_ERROR);
+	}
+#else
+	(void)overflow;
+	(void)lineError;
+#endif
+
+	if((received != head) && (NULL_PTR != Uart_Channels[Channel].RxNotification))
+	{
+		Uart_Channels[Channel].RxNotification();
+	}
+}
+
+/************************************************************************************
+* Description: Common part of the UART ISRs ... acknowledge the interrupts, drain the RX FIFO on
+*              the receive level or the receive timeout and refill the TX FIFO on the transmit
+*              level. The transmit interrupt is masked when the transmit ring is empty.
+************************************************************************************/
+STATIC void Uart_Isr(uint8 HwUnit)
+{
+	uint8 channel = Uart_HwChannels[HwUnit];
+	uint32 base = Uart_BaseAddress[HwUnit];
+	uint32 status;
+
+	status = UART_REG(base, UART_MIS_REG_OFFSET);
+	UART_REG(base, UART_ICR_REG_OFFSET) = status;
+
+	if(UART_NO_CHANNEL != channel)
+	{
+		if(0U != (status & (UART_INT_RX | UART_INT_RT)))
+		{
+			Uart_DrainRxFifo(channel);
+		}
+		if(0U != (status & UART_INT_TX))
+		{
+			Uart_FillTxFifo(channel);
+			if(Uart_Buffers[channel].TxTail == Uart_Buffers[channel].TxHead)
+			{
+				UART_REG(base, UART_IM_REG_OFFSET) &= ~UART_INT_TX;
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Description: UART ISRs installed by Uart_Init
+************************************************************************************/
+STATIC void Uart_Hw0Isr(void)
+{
+	Uart_Isr(0U);
+}
+
+STATIC void Uart_Hw1Isr(void)
+{
+	Uart_Isr(1U);
+}
+
+STATIC void Uart_Hw2Isr(void)
+{
+	Uart_Isr(2U);
+}
+
+STATIC void Uart_Hw3Isr(void)
+{
+	Uart_Isr(3U);
+}
+
+STATIC void Uart_Hw4Isr(void)
+{
+	Uart_Isr(4U);
+}
+
+STATIC void Uart_Hw5Isr(void)
+{
+	Uart_Isr(5U);
+}
+
+STATIC void Uart_Hw6Isr(void)
+{
+	Uart_Isr(6U);
+}
+
+STATIC void Uart_Hw7Isr(void)
+{
+	Uart_Isr(7U);
+}
+
+/* ISR of each UART module */
+STATIC const Irq_HandlerType Uart_HwHandlers[UART_NUMBER_OF_HW_UNITS] = {
+                                                                           Uart_Hw0Isr, Uart_Hw1Isr,
+                                                                           Uart_Hw2Isr, Uart_Hw3Isr,
+                                                                           Uart_Hw4Isr, Uart_Hw5Isr,
+                                                                           Uart_Hw6Isr, Uart_Hw7Isr
+                                                                       };
+
+/************************************************************************************
+* Description: Start the transmission of the queued bytes if the transmit interrupt is idle:
+*              the TX FIFO is filled here and the interrupt refills it while bytes remain.
+*              The FIFO is full when bytes remain, so the transmit level is crossed later.
+************************************************************************************/
+STATIC void Uart_StartTx(Uart_ChannelType Channel)
+{
+	uint32 base = Uart_BaseAddress[Uart_Channels[Channel].HwUnit];
+
+	SuspendAllInterrupts();
+	if(0U == (UART_REG(base, UART_IM_REG_OFFSET) & UART_INT_TX))
+	{
+		Uart_FillTxFifo(Channel);
+		if(Uart_Buffers[Channel].TxTail != Uart_Buffers[Channel].TxHead)
+		{
+			UART_REG(base, UART_IM_REG_OFFSET) |= UART_INT_TX;
+		}
+	}
+	ResumeAllInterrupts();
+}
+
+/************************************************************************************
+* Service Name: Uart_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Uart module:
+*              - Enable the clock of the used UART modules
+*              - Set the baud rate, the frame format and the FIFO levels of the channels
+*              - Enable the receive and receive timeout interrupts and install the ISRs
+*              The channel pins are configured in UART_MODE by the Port Driver.
+************************************************************************************/
+void Uart_Init(const Uart_ConfigType * ConfigPtr)
+{
+	Uart_ChannelType channel;
+	uint8 hwUnit;
+	uint32 base;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_INIT_SID,
+		     UART_E_PARAM_CONFIG);
+	}
+	else if (UART_INITIALIZED == Uart_Status)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_INIT_SID,
+		     UART_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		Uart_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		for(hwUnit = 0; hwUnit < UART_NUMBER_OF_HW_UNITS; hwUnit++)
+		{
+			Uart_HwChannels[hwUnit] = UART_NO_CHANNEL;
+		}
+
+		for(channel = 0; channel < UART_NUMBER_OF_CHANNELS; channel++)
+		{
+			hwUnit = (uint8)Uart_Channels[channel].HwUnit;
+			base = Uart_BaseAddress[hwUnit];
+			Uart_HwChannels[hwUnit] = channel;
+			Uart_Buffers[channel].TxHead = 0;
+			Uart_Buffers[channel].TxTail = 0;
+			Uart_Buffers[channel].RxHead = 0;
+			Uart_Buffers[channel].RxTail = 0;
+
+			UART_SYSCTL_RCGCUART_REG |= (1UL << hwUnit);
+			while(0U == (UART_SYSCTL_PRUART_REG & (1UL << hwUnit)));
+
+			/* The UART is disabled while its line is configured, it is clocked by the system clock */
+			UART_REG(base, UART_CTL_REG_OFFSET) = 0;
+			UART_REG(base, UART_CC_REG_OFFSET)  = 0;
+			Uart_SetLine(channel);
+			UART_REG(base, UART_IFLS_REG_OFFSET) = ((uint32)Uart_Channels[channel].RxFifoLevel << UART_IFLS_RX_POS)
+			                                     | ((uint32)Uart_Channels[channel].TxFifoLevel << UART_IFLS_TX_POS);
+
+			/* The transmit interrupt is enabled by Uart_Write while bytes are queued */
+			UART_REG(base, UART_ICR_REG_OFFSET) = UART_INT_ALL;
+			UART_REG(base, UART_IM_REG_OFFSET)  = UART_INT_RX | UART_INT_RT;
+			UART_REG(base, UART_CTL_REG_OFFSET) = UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+
+			Irq_Register(Uart_HwIrq[hwUnit], Uart_HwHandlers[hwUnit], UART_INTERRUPT_PRIORITY);
+			Irq_EnableInterrupt(Uart_HwIrq[hwUnit]);
+		}
+
+		Uart_Status = UART_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+* Service Name: Uart_Write
+* Service ID[hex]: 0x01
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - Numeric identifier of the Uart channel
+*                  Data - Bytes to send
+*                  Length - Number of bytes to send
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of bytes queued, lower than Length when the transmit ring is full
+* Description: Function to queue bytes in the transmit ring of a channel without waiting,
+*              they are sent by the transmit interrupt. Uart_GetTxSpace gives the number of
+*              bytes which can be queued, e.g. to write a message only when it fits entirely.
+************************************************************************************/
+uint16 Uart_Write(Uart_ChannelType Channel, const uint8 * Data, uint16 Length)
+{
+	boolean error = FALSE;
+	Uart_BufferType * buffer;
+	uint16 head;
+	uint16 count = 0;
+	uint16 i;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (UART_NOT_INITIALIZED == Uart_Status)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_WRITE_SID, UART_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (UART_NUMBER_OF_CHANNELS <= Channel)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_WRITE_SID, UART_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else if (NULL_PTR == Data)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_WRITE_SID, UART_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		buffer = &Uart_Buffers[Channel];
+		head = buffer->TxHead;
+		count = UART_TX_BUFFER_SIZE - (uint16)(head - buffer->TxTail);
+		if(count > Length)
+		{
+			count = Length;
+		}
+
+		for(i = 0; i < count; i++)
+		{
+			buffer->Tx[(uint16)(head + i) & (UART_TX_BUFFER_SIZE - 1U)] = Data[i];
+		}
+		/* Publish the bytes to the transmit interrupt */
+		buffer->TxHead = head + count;
+
+		if(count != 0U)
+		{
+			Uart_StartTx(Channel);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return count;
+}
+
+/************************************************************************************
+* Service Name: Uart_Read
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - Numeric identifier of the Uart channel
+*                  Length - Size of the Data buffer
+* Parameters (inout): None
+* Parameters (out): Data - Received bytes
+* Return value: uint16 - Number of bytes read, 0 if nothing was received
+* Description: Function to take the received bytes from the receive ring of a channel without waiting.
+************************************************************************************/
+uint16 Uart_Read(Uart_ChannelType Channel, uint8 * Data, uint16 Length)
+{
+	boolean error = FALSE;
+	Uart_BufferType * buffer;
+	uint16 tail;
+	uint16 count = 0;
+	uint16 i;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (UART_NOT_INITIALIZED == Uart_Status)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_READ_SID, UART_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (UART_NUMBER_OF_CHANNELS <= Channel)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_READ_SID, UART_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else if (NULL_PTR == Data)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_READ_SID, UART_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		buffer = &Uart_Buffers[Channel];
+		tail = buffer->RxTail;
+		count = (uint16)(buffer->RxHead - tail);
+		if(count > Length)
+		{
+			count = Length;
+		}
+
+		for(i = 0; i < count; i++)
+		{
+			Data[i] = buffer->Rx[(uint16)(tail + i) & (UART_RX_BUFFER_SIZE - 1U)];
+		}
+		/* Give the space back to the receive interrupts */
+		buffer->RxTail = tail + count;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return count;
+}
+
+/************************************************************************************
+* Service Name: Uart_GetTxSpace
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the Uart channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of free bytes in the transmit ring
+* Description: Function to read the number of bytes which Uart_Write can queue now.
+************************************************************************************/
+uint16 Uart_GetTxSpace(Uart_ChannelType Channel)
+{
+	uint16 space = 0;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (UART_NOT_INITIALIZED == Uart_Status)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_GET_TX_SPACE_SID, UART_E_UNINIT);
+	}
+	/* Check if the used channel is within the valid range */
+	else if (UART_NUMBER_OF_CHANNELS <= Channel)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_GET_TX_SPACE_SID, UART_E_PARAM_CHANNEL);
+	}
+	else
+#endif
+	{
+		space = UART_TX_BUFFER_SIZE - (uint16)(Uart_Buffers[Channel].TxHead - Uart_Buffers[Channel].TxTail);
+	}
+	return space;
+}
+
+/************************************************************************************
+* Service Name: Uart_GetRxCount
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the Uart channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of received bytes in the receive ring
+* Description: Function to read the number of bytes which Uart_Read can take now.
+************************************************************************************/
+uint16 Uart_GetRxCount(Uart_ChannelType Channel)
+{
+	uint16 count = 0;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (UART_NOT_INITIALIZED == Uart_Status)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_GET_RX_COUNT_SID, UART_E_UNINIT);
+	}
+	/* Check if the used channel is within the valid range */
+	else if (UART_NUMBER_OF_CHANNELS <= Channel)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID,
+				UART_GET_RX_COUNT_SID, UART_E_PARAM_CHANNEL);
+	}
+	else
+#endif
+	{
+		count = (uint16)(Uart_Buffers[Channel].RxHead - Uart_Buffers[Channel].RxTail);
+	}
+	return count;
+}
+
+/************************************************************************************
+* Service Name: Uart_ClockNotification
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function called by Mcu after each change of the system clock frequency,
+*              the baud rate divisors are computed again for the new frequency. A UART disabled
+*              during a byte finishes it before it stops, the FIFOs keep their bytes.
+************************************************************************************/
+void Uart_ClockNotification(void)
+{
+	Uart_ChannelType channel;
+	uint32 base;
+
+	if(UART_INITIALIZED == Uart_Status)
+	{
+		for(channel = 0; channel < UART_NUMBER_OF_CHANNELS; channel++)
+		{
+			base = Uart_BaseAddress[Uart_Channels[channel].HwUnit];
+			UART_REG(base, UART_CTL_REG_OFFSET) &= ~UART_CTL_UARTEN;
+			Uart_SetLine(channel);
+			UART_REG(base, UART_CTL_REG_OFFSET) |= UART_CTL_UARTEN;
+		}
+	}
+}
@@ -0,0 +1,204 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Uart Driver
+ *              (interrupt driven, the bytes are buffered in software rings)
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef UART_H
+#define UART_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define UART_VENDOR_ID    (1000U)
+
+/* Uart Module Id (complex driver, there is no AUTOSAR Uart Driver) */
+#define UART_MODULE_ID    (252U)
+
+/* Uart Instance Id */
+#define UART_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define UART_SW_MAJOR_VERSION           (1U)
+#define UART_SW_MINOR_VERSION           (0U)
+#define UART_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define UART_AR_RELEASE_MAJOR_VERSION   (4U)
+#define UART_AR_RELEASE_MINOR_VERSION   (0U)
+#define UART_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Uart Status
+ */
+#define UART_INITIALIZED                (1U)
+#define UART_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Uart Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Uart Pre-Compile Configuration Header file */
+#include "Uart_Cfg.h"
+
+/* AUTOSAR Version checking between Uart_Cfg.h and Uart.h files */
+#if ((UART_CFG_AR_RELEASE_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION)\
+ ||  (UART_CFG_AR_RELEASE_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION)\
+ ||  (UART_CFG_AR_RELEASE_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Uart_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Uart_Cfg.h and Uart.h files */
+#if ((UART_CFG_SW_MAJOR_VERSION != UART_SW_MAJOR_VERSION)\
+ ||  (UART_CFG_SW_MINOR_VERSION != UART_SW_MINOR_VERSION)\
+ ||  (UART_CFG_SW_PATCH_VERSION != UART_SW_PATCH_VERSION))
+  #error "The SW version of Uart_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Uart Init */
+#define UART_INIT_SID                        (uint8)0x00
+
+/* Service ID for Uart Write */
+#define UART_WRITE_SID                       (uint8)0x01
+
+/* Service ID for Uart Read */
+#define UART_READ_SID                        (uint8)0x02
+
+/* Service ID for Uart Get Tx Space */
+#define UART_GET_TX_SPACE_SID                (uint8)0x03
+
+/* Service ID for Uart Get Rx Count */
+#define UART_GET_RX_COUNT_SID                (uint8)0x04
+
+/* Service ID for the errors found by the Uart ISR */
+#define UART_ISR_SID                         (uint8)0x80
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Uart_Init API service called with NULL pointer parameter */
+#define UART_E_PARAM_CONFIG                  (uint8)0x10
+
+/* API service used without module initialization */
+#define UART_E_UNINIT                        (uint8)0x11
+
+/* DET code to report Invalid Channel */
+#define UART_E_PARAM_CHANNEL                 (uint8)0x12
+
+/* API service called with a NULL pointer */
+#define UART_E_PARAM_POINTER                 (uint8)0x13
+
+/* Uart_Init API service called while the module is already initialized */
+#define UART_E_ALREADY_INITIALIZED           (uint8)0x14
+
+/* Received bytes dropped because the receive ring was full */
+#define UART_E_RX_OVERFLOW                   (uint8)0x80
+
+/* Received bytes dropped because of a framing, parity, break or FIFO overrun error */
+#define UART_E_RX_LINE_ERROR                 (uint8)0x81
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the Uart channels (index in Uart_PBcfg.c) */
+typedef uint8 Uart_ChannelType;
+
+/* Type definition for the UART modules */
+typedef enum
+{
+	UART_HW_0,UART_HW_1,UART_HW_2,UART_HW_3,UART_HW_4,UART_HW_5,UART_HW_6,UART_HW_7
+}Uart_HwUnitType;
+
+/* Type definition for the parity bit */
+typedef enum
+{
+	UART_PARITY_NONE,UART_PARITY_EVEN,UART_PARITY_ODD
+}Uart_ParityType;
+
+/* Type definition for the FIFO trigger levels (16 bytes FIFOs):
+ * the receive interrupt is raised when the RX FIFO fills up to the level,
+ * the transmit interrupt is raised when the TX FIFO drains down to the level */
+typedef enum
+{
+	UART_FIFO_1_8,UART_FIFO_1_4,UART_FIFO_1_2,UART_FIFO_3_4,UART_FIFO_7_8
+}Uart_FifoLevelType;
+
+typedef struct
+{
+	/* Member contains the UART module of the channel */
+	Uart_HwUnitType HwUnit;
+	/* Member contains the baud rate in bits per second */
+	uint32 BaudRate;
+	/* Member contains the number of data bits (5 .. 8) */
+	uint8 DataBits;
+	/* Member contains the parity bit */
+	Uart_ParityType Parity;
+	/* Member contains the number of stop bits (1 or 2) */
+	uint8 StopBits;
+	/* Member contains the RX FIFO level of the receive interrupt, the bytes below it are
+	 * drained by the receive timeout interrupt after 32 bit periods without a new byte */
+	Uart_FifoLevelType RxFifoLevel;
+	/* Member contains the TX FIFO level of the transmit interrupt which refills the FIFO */
+	Uart_FifoLevelType TxFifoLevel;
+	/* Member contains the function called from the ISR after new bytes are received (NULL_PTR if none) */
+	void (*RxNotification)(void);
+}Uart_ConfigChannel;
+
+/* Data Structure required for initializing the Uart Driver */
+typedef struct Uart_ConfigType
+{
+	Uart_ConfigChannel Channels[UART_NUMBER_OF_CHANNELS];
+} Uart_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for Uart Initialization API */
+void Uart_Init(const Uart_ConfigType * ConfigPtr);
+
+/* Function for Uart Write API, it queues the bytes which fit in the transmit ring without waiting */
+uint16 Uart_Write(Uart_ChannelType Channel, const uint8 * Data, uint16 Length);
+
+/* Function for Uart Read API, it takes the received bytes from the receive ring without waiting */
+uint16 Uart_Read(Uart_ChannelType Channel, uint8 * Data, uint16 Length);
+
+/* Function for Uart Get Tx Space API */
+uint16 Uart_GetTxSpace(Uart_ChannelType Channel);
+
+/* Function for Uart Get Rx Count API */
+uint16 Uart_GetRxCount(Uart_ChannelType Channel);
+
+/* Function called by Mcu after each change of the system clock frequency */
+void Uart_ClockNotification(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Uart and other modules */
+extern const Uart_ConfigType Uart_Configuration;
+
+#endif /* UART_H */
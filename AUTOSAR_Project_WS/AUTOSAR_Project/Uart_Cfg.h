@@ -0,0 +1,45 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Uart Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef UART_CFG_H
+#define UART_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define UART_CFG_SW_MAJOR_VERSION              (1U)
+#define UART_CFG_SW_MINOR_VERSION              (0U)
+#define UART_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define UART_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define UART_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define UART_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define UART_DEV_ERROR_DETECT               (STD_ON)
+
+/* Priority of the UART interrupts */
+#define UART_INTERRUPT_PRIORITY             (2U)
+
+/* Size of the transmit and receive rings of each channel in bytes (powers of 2) */
+#define UART_TX_BUFFER_SIZE                 (128U)
+#define UART_RX_BUFFER_SIZE                 (64U)
+
+/* Number of the configured Uart Channels */
+#define UART_NUMBER_OF_CHANNELS             (1U)
+
+/* Channel Index in the array of structures in Uart_PBcfg.c */
+#define UartConf_CONSOLE_CHANNEL_ID_INDEX   (uint8)0x00
+
+#endif /* UART_CFG_H */
@@ -0,0 +1,48 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Uart Driver
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Uart.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define UART_PBCFG_SW_MAJOR_VERSION              (1U)
+#define UART_PBCFG_SW_MINOR_VERSION              (0U)
+#define UART_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define UART_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define UART_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define UART_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Uart_PBcfg.c and Uart.h files */
+#if ((UART_PBCFG_AR_RELEASE_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION)\
+ ||  (UART_PBCFG_AR_RELEASE_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION)\
+ ||  (UART_PBCFG_AR_RELEASE_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Uart_PBcfg.c and Uart.h files */
+#if ((UART_PBCFG_SW_MAJOR_VERSION != UART_SW_MAJOR_VERSION)\
+ ||  (UART_PBCFG_SW_MINOR_VERSION != UART_SW_MINOR_VERSION)\
+ ||  (UART_PBCFG_SW_PATCH_VERSION != UART_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+
+/* PB structure used with Uart_Init API --> Hardware unit, Baud rate, Data bits, Parity, Stop bits,
+ *                                          RX FIFO level, TX FIFO level, Rx notification
+ * UART0 on PA0 (U0Rx) and PA1 (U0Tx) is the virtual COM port of the debugger USB link */
+const Uart_ConfigType Uart_Configuration = {
+                                               UART_HW_0,115200UL,8,UART_PARITY_NONE,1,UART_FIFO_1_2,UART_FIFO_1_8,NULL_PTR   /* Console 115200 8N1 */
+                                           };
@@ -0,0 +1,85 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Uart Driver Registers
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef UART_REGS_H
+#define UART_REGS_H
+
+#include "Std_Types.h"
+
+/* UART modules base addresses, the register access macros below can be defined before this file
+ * is included to run the driver on a simulated register block (Tools/Uart_HostTest) */
+#ifndef UART_HW0_BASE_ADDRESS
+#define UART_HW0_BASE_ADDRESS             0x4000C000
+#define UART_HW1_BASE_ADDRESS             0x4000D000
+#define UART_HW2_BASE_ADDRESS             0x4000E000
+#define UART_HW3_BASE_ADDRESS             0x4000F000
+#define UART_HW4_BASE_ADDRESS             0x40010000
+#define UART_HW5_BASE_ADDRESS             0x40011000
+#define UART_HW6_BASE_ADDRESS             0x40012000
+#define UART_HW7_BASE_ADDRESS             0x40013000
+#endif
+
+/* UART Registers offset addresses */
+#define UART_DR_REG_OFFSET                0x000     /* Data (error flags in bits 11:8 on read) */
+#define UART_FR_REG_OFFSET                0x018     /* Flags */
+#define UART_IBRD_REG_OFFSET              0x024     /* Integer Baud-Rate Divisor */
+#define UART_FBRD_REG_OFFSET              0x028     /* Fractional Baud-Rate Divisor */
+#define UART_LCRH_REG_OFFSET              0x02C     /* Line Control, its write latches IBRD and FBRD */
+#define UART_CTL_REG_OFFSET               0x030     /* Control */
+#define UART_IFLS_REG_OFFSET              0x034     /* Interrupt FIFO Level Select */
+#define UART_IM_REG_OFFSET                0x038     /* Interrupt Mask */
+#define UART_MIS_REG_OFFSET               0x040     /* Masked Interrupt Status */
+#define UART_ICR_REG_OFFSET               0x044     /* Interrupt Clear */
+#define UART_CC_REG_OFFSET                0xFC8     /* Clock Configuration */
+
+/* Access a UART register */
+#ifndef UART_REG
+#define UART_REG(BASE,OFFSET)             (*((volatile uint32 *)((BASE) + (OFFSET))))
+#endif
+
+/* Data register error flags: framing, parity, break and overrun */
+#define UART_DR_ERROR_MASK                0x00000F00
+
+/* Flag register bits */
+#define UART_FR_RXFE                      0x00000010
+#define UART_FR_TXFF                      0x00000020
+
+/* Line Control bits */
+#define UART_LCRH_PEN                     0x00000002
+#define UART_LCRH_EPS                     0x00000004
+#define UART_LCRH_STP2                    0x00000008
+#define UART_LCRH_FEN                     0x00000010
+#define UART_LCRH_WLEN_POS                (5U)
+
+/* Control bits */
+#define UART_CTL_UARTEN                   0x00000001
+#define UART_CTL_TXE                      0x00000100
+#define UART_CTL_RXE                      0x00000200
+
+/* FIFO level fields */
+#define UART_IFLS_TX_POS                  (0U)
+#define UART_IFLS_RX_POS                  (3U)
+
+/* Interrupt bits of the IM, MIS and ICR registers: receive, transmit, receive timeout and errors */
+#define UART_INT_RX                       0x00000010
+#define UART_INT_TX                       0x00000020
+#define UART_INT_RT                       0x00000040
+#define UART_INT_ALL                      0x000017F2
+
+/* UART module clock gating control and peripheral ready registers */
+#ifndef UART_SYSCTL_RCGCUART_REG
+#define UART_SYSCTL_RCGCUART_REG          (*((volatile uint32 *)0x400FE618))
+#endif
+#ifndef UART_SYSCTL_PRUART_REG
+#define UART_SYSCTL_PRUART_REG            (*((volatile uint32 *)0x400FEA18))
+#endif
+
+#endif /* UART_REGS_H */
@@ -24,6 +24,10 @@ MEMORY
 /* --stack_size=256                                                          */
 /* --library=rtsv7M4_T_le_eabi.lib                                           */
 
+/* FAST_STARTUP is shared with tm4c123gh6pm_startup_ccs.c, when it is 1      */
+/* ResetISR initializes .data and .bss itself instead of _c_int00.           */
+#include "Startup_Cfg.h"
+
 /* Section allocation in memory */
 
 SECTIONS
@@ -36,10 +40,19 @@ SECTIONS
     .init_array : > FLASH
 
     .vtable :   > 0x20000000
+#if (FAST_STARTUP == 1)
+    .data   :   LOAD = FLASH, RUN = SRAM, LOAD_START(__data_load__),
+                RUN_START(__data_start__), RUN_END(__data_end__), palign(4)
+    .bss    :   > SRAM, RUN_START(__bss_start__), RUN_END(__bss_end__), palign(4)
+#else
     .data   :   > SRAM
     .bss    :   > SRAM
+#endif
     .sysmem :   > SRAM
     .stack  :   > SRAM
+
+    /* Kept across the software and watchdog resets, it is neither zeroed nor initialized by the C startup */
+    .noinit :   > SRAM, type = NOINIT
 }
 
 __STACK_TOP = __stack + 512;
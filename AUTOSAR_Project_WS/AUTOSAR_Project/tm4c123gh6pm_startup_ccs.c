@@ -23,6 +23,10 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+#include "Startup_Cfg.h"
+#include "tm4c123gh6pm_registers.h"
 
 //*****************************************************************************
 //
@@ -31,17 +35,69 @@
 //*****************************************************************************
 void ResetISR(void);
 static void NmiSR(void);
-static void FaultISR(void);
 static void IntDefaultHandler(void);
+extern void Fault_Handler(void);
+#if (OS_PREEMPTION == STD_ON)
+extern void PendSV_Handler(void);
+#endif
 extern void SysTick_Handler(void);
 
+//*****************************************************************************
+//
+// Set FAST_STARTUP to 1 in Startup_Cfg.h to initialize .data and .bss in
+// ResetISR with 16-byte block copies (LDM/STM) and call main directly, instead
+// of the table driven initialization of _c_int00.  tm4c123gh6pm.cmd reads the
+// same header to place .data for this copy.  The .noinit section is never
+// touched by either path.  The application has no C++ constructors and does
+// not return from main, so _c_int00 has nothing else to do.
+//
+//*****************************************************************************
+
 //*****************************************************************************
 //
 // External declaration for the reset handler that is to be called when the
 // processor is started
 //
 //*****************************************************************************
+#if (FAST_STARTUP == 1)
+extern int main(void);
+#else
 extern void _c_int00(void);
+#endif
+
+//*****************************************************************************
+//
+// Linker variables that mark the load and run addresses of .data and the run
+// addresses of .bss (FAST_STARTUP only).
+//
+//*****************************************************************************
+#if (FAST_STARTUP == 1)
+extern uint32_t __data_load__;
+extern uint32_t __data_start__;
+extern uint32_t __data_end__;
+extern uint32_t __bss_start__;
+extern uint32_t __bss_end__;
+
+//
+// Block of four words, its assignment is done with one LDM/STM pair.
+//
+typedef struct
+{
+    uint32_t ui32Word[4];
+}
+tBlock;
+#endif
+
+//*****************************************************************************
+//
+// Bits of the core registers used by ResetISR: the coprocessor access control
+// register which enables the FPU, and the DWT cycle counter which measures the
+// time to main (Os_GetStartupCycles).
+//
+//*****************************************************************************
+#define CPAC_CP10_CP11_FULL     0x00F00000
+#define DEMCR_TRCENA            0x01000000
+#define DWT_CTRL_CYCCNTENA      0x00000001
 
 //*****************************************************************************
 //
@@ -50,6 +106,29 @@ extern void _c_int00(void);
 //*****************************************************************************
 extern uint32_t __STACK_TOP;
 
+//*****************************************************************************
+//
+// Linker variable that marks the bottom of the stack.
+//
+//*****************************************************************************
+extern uint32_t __stack;
+
+//*****************************************************************************
+//
+// Pattern written to the unused stack at reset, the Os measures the stack
+// high-water mark by searching the lowest overwritten word.  It must match
+// OS_STACK_PAINT_PATTERN in Os.h.
+//
+//*****************************************************************************
+#define STACK_PAINT_PATTERN     0xA5A5A5A5
+
+//*****************************************************************************
+//
+// Number of words below the frame of ResetISR which are not painted.
+//
+//*****************************************************************************
+#define STACK_PAINT_MARGIN      16
+
 //*****************************************************************************
 //
 // External declarations for the interrupt handlers used by the application.
@@ -61,7 +140,9 @@ extern uint32_t __STACK_TOP;
 //
 // The vector table.  Note that the proper constructs must be placed on this to
 // ensure that it ends up at physical address 0x0000.0000 or at the start of
-// the program if located at a start address other than 0.
+// the program if located at a start address other than 0.  Irq_Init copies
+// it to RAM, the drivers then install their peripheral interrupt handlers with
+// Irq_Register, only the exception handlers are listed here.
 //
 //*****************************************************************************
 #pragma DATA_SECTION(g_pfnVectors, ".intvecs")
@@ -71,10 +152,10 @@ void (* const g_pfnVectors[])(void) =
                                             // The initial stack pointer
     ResetISR,                               // The reset handler
     NmiSR,                                  // The NMI handler
-    FaultISR,                               // The hard fault handler
-    IntDefaultHandler,                      // The MPU fault handler
-    IntDefaultHandler,                      // The bus fault handler
-    IntDefaultHandler,                      // The usage fault handler
+    Fault_Handler,                          // The hard fault handler
+    Fault_Handler,                          // The MPU fault handler
+    Fault_Handler,                          // The bus fault handler
+    Fault_Handler,                          // The usage fault handler
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
@@ -82,7 +163,11 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
-    IntDefaultHandler,                      // The PendSV handler
+#if (OS_PREEMPTION == STD_ON)
+    PendSV_Handler,                         // The PendSV handler
+#else
+    IntDefaultHandler,                      // The PendSV handler (unused without preemption)
+#endif
     SysTick_Handler,                        // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
@@ -238,12 +323,81 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    uint32_t *pui32Dest;
+    uint32_t ui32Marker;
+#if (FAST_STARTUP == 1)
+    uint32_t *pui32Src;
+    tBlock sZero = {{0, 0, 0, 0}};
+#endif
+
+    //
+    // Start the cycle counter first so main can read the startup time.
+    //
+    CORE_DEMCR_REG |= DEMCR_TRCENA;
+    DWT_CYCCNT_REG = 0;
+    DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA;
+
+    //
+    // Paint the stack from its bottom up to a margin below the frame of this
+    // function, the words above are used by the startup code anyway.
+    //
+    for(pui32Dest = &__stack; pui32Dest < (&ui32Marker - STACK_PAINT_MARGIN);
+        pui32Dest++)
+    {
+        *pui32Dest = STACK_PAINT_PATTERN;
+    }
+
+#if (FAST_STARTUP == 1)
+    //
+    // Enable the floating-point unit before any code which may use it.
+    //
+    CORE_CPAC_REG |= CPAC_CP10_CP11_FULL;
+    __asm("    dsb\n"
+          "    isb");
+
+    //
+    // Copy the .data initializers from flash to SRAM, four words at a time
+    // then the remaining words.
+    //
+    pui32Src = &__data_load__;
+    for(pui32Dest = &__data_start__; (pui32Dest + 4) <= &__data_end__;
+        pui32Dest += 4, pui32Src += 4)
+    {
+        *(tBlock *)pui32Dest = *(const tBlock *)pui32Src;
+    }
+    while(pui32Dest < &__data_end__)
+    {
+        *pui32Dest++ = *pui32Src++;
+    }
+
+    //
+    // Zero fill .bss the same way.
+    //
+    for(pui32Dest = &__bss_start__; (pui32Dest + 4) <= &__bss_end__;
+        pui32Dest += 4)
+    {
+        *(tBlock *)pui32Dest = sZero;
+    }
+    while(pui32Dest < &__bss_end__)
+    {
+        *pui32Dest++ = 0;
+    }
+
+    //
+    // Call the application, it does not return.
+    //
+    main();
+    while(1)
+    {
+    }
+#else
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
     //
     __asm("    .global _c_int00\n"
           "    b.w     _c_int00");
+#endif
 }
 
 //*****************************************************************************
@@ -264,24 +418,6 @@ NmiSR(void)
     }
 }
 
-//*****************************************************************************
-//
-// This is the code that gets called when the processor receives a fault
-// interrupt.  This simply enters an infinite loop, preserving the system state
-// for examination by a debugger.
-//
-//*****************************************************************************
-static void
-FaultISR(void)
-{
-    //
-    // Enter an infinite loop.
-    //
-    while(1)
-    {
-    }
-}
-
 //*****************************************************************************
 //
 // This is the code that gets called when the processor receives an unexpected
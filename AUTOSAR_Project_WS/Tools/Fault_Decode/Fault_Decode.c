@@ -0,0 +1,247 @@
+ /******************************************************************************
+ *
+ * Module: Fault
+ *
+ * File Name: Fault_Decode.c
+ *
+ * Description: Host tool which prints the crash record saved by the Fault Handler
+ *              (Fault_Record in Fault.c) before the reset of the target.
+ *
+ *              Build : gcc -std=c99 -Wall -o Fault_Decode Fault_Decode.c
+ *              Usage : Fault_Decode <record file>
+ *
+ *              Record file: the Fault_Record words saved from the CCS Memory Browser
+ *              (Save Memory, address of Fault_Record in the .map file, 34 words) either
+ *              in the "TI Data" format (32-bit hex) or as a raw little-endian binary file.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Must match FAULT_RECORD_SIGNATURE in Fault.h */
+#define FAULT_RECORD_SIGNATURE      (0xFA017C0DUL)
+
+/* Must match FAULT_STACK_WINDOW_WORDS in Fault_Cfg.h */
+#define FAULT_STACK_WINDOW_WORDS    (16U)
+
+/* Word index of each member of Fault_RecordType in Fault.h */
+#define REC_SIGNATURE               (0U)
+#define REC_COUNT                   (1U)
+#define REC_EXCEPTION               (2U)
+#define REC_EXC_RETURN              (3U)
+#define REC_FRAME                   (4U)
+#define REC_CFSR                    (12U)
+#define REC_HFSR                    (13U)
+#define REC_MMFAR                   (14U)
+#define REC_BFAR                    (15U)
+#define REC_STACK_POINTER           (16U)
+#define REC_STACK                   (17U)
+#define REC_CHECKSUM                (REC_STACK + FAULT_STACK_WINDOW_WORDS)
+#define REC_WORDS                   (REC_CHECKSUM + 1U)
+
+/* Magic number of the first line of a "TI Data" memory file */
+#define TI_DATA_MAGIC               "1651"
+
+typedef struct
+{
+    unsigned int Bit;
+    const char * Name;
+    const char * Meaning;
+}Decode_BitType;
+
+/* Configurable Fault Status register: MemManage (7:0), BusFault (15:8) and UsageFault (31:16) status */
+static const Decode_BitType g_Cfsr_Bits[] =
+{
+    { 0, "IACCVIOL",    "instruction fetch from a no-execute region" },
+    { 1, "DACCVIOL",    "data access violation, address in MMFAR" },
+    { 3, "MUNSTKERR",   "MemManage fault on exception return unstacking" },
+    { 4, "MSTKERR",     "MemManage fault on exception entry stacking (stack overflow ?)" },
+    { 5, "MLSPERR",     "MemManage fault on lazy FPU state preservation" },
+    { 7, "MMARVALID",   "MMFAR holds the faulting address" },
+    { 8, "IBUSERR",     "bus error on instruction prefetch" },
+    { 9, "PRECISERR",   "precise data bus error, address in BFAR" },
+    {10, "IMPRECISERR", "imprecise data bus error (the stacked PC is after the faulting store)" },
+    {11, "UNSTKERR",    "bus fault on exception return unstacking" },
+    {12, "STKERR",      "bus fault on exception entry stacking (stack overflow ?)" },
+    {13, "LSPERR",      "bus fault on lazy FPU state preservation" },
+    {15, "BFARVALID",   "BFAR holds the faulting address" },
+    {16, "UNDEFINSTR",  "undefined instruction" },
+    {17, "INVSTATE",    "invalid EPSR state (call through a function pointer with bit 0 clear ?)" },
+    {18, "INVPC",       "invalid EXC_RETURN on exception return" },
+    {19, "NOCP",        "coprocessor access while disabled (FPU not enabled ?)" },
+    {24, "UNALIGNED",   "unaligned access (LDM/STM/LDRD or trap enabled)" },
+    {25, "DIVBYZERO",   "division by zero (trap enabled)" }
+};
+
+/* Hard Fault Status register */
+static const Decode_BitType g_Hfsr_Bits[] =
+{
+    { 1, "VECTTBL",     "bus fault on a vector table read" },
+    {30, "FORCED",      "escalated configurable fault, see CFSR" },
+    {31, "DEBUGEVT",    "debug event" }
+};
+
+static const char * const g_Frame_Names[8] = { "R0", "R1", "R2", "R3", "R12", "LR", "PC", "xPSR" };
+
+static unsigned long g_Record[REC_WORDS];
+
+/*********************************************************************************************/
+/* Description: Same checksum as NoInit_Checksum in NoInit.c */
+static unsigned long Decode_Checksum(void)
+{
+    unsigned long sum = 0;
+    unsigned int index;
+
+    for(index = 0; index < REC_CHECKSUM; index++)
+    {
+        sum = (((sum << 1) | (sum >> 31)) ^ g_Record[index]) & 0xFFFFFFFFUL;
+    }
+    return (~sum) & 0xFFFFFFFFUL;
+}
+
+/*********************************************************************************************/
+/* Description: Read the record words from a "TI Data" text file or a raw binary file */
+static int Decode_ReadRecord(const char * Path)
+{
+    FILE * file = fopen(Path, "rb");
+    char line[128];
+    unsigned char bytes[REC_WORDS * 4];
+    unsigned int count = 0;
+    unsigned int index;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "Fault_Decode: can not open %s\n", Path);
+        return 0;
+    }
+
+    if((fgets(line, sizeof(line), file) != NULL) && (strncmp(line, TI_DATA_MAGIC, strlen(TI_DATA_MAGIC)) == 0))
+    {
+        /* One 0xXXXXXXXX word per line after the header line */
+        while((count < REC_WORDS) && (fgets(line, sizeof(line), file) != NULL))
+        {
+            char * end;
+            unsigned long word = strtoul(line, &end, 16);
+            if(end != line)
+            {
+                g_Record[count++] = word;
+            }
+        }
+    }
+    else
+    {
+        rewind(file);
+        count = (unsigned int)(fread(bytes, 1, sizeof(bytes), file) / 4);
+        for(index = 0; index < count; index++)
+        {
+            g_Record[index] = (unsigned long)bytes[4 * index]
+                            | ((unsigned long)bytes[(4 * index) + 1] << 8)
+                            | ((unsigned long)bytes[(4 * index) + 2] << 16)
+                            | ((unsigned long)bytes[(4 * index) + 3] << 24);
+        }
+    }
+    fclose(file);
+
+    if(count < REC_WORDS)
+    {
+        fprintf(stderr, "Fault_Decode: %s holds %u words, the record has %u\n", Path, count, REC_WORDS);
+        return 0;
+    }
+    return 1;
+}
+
+/*********************************************************************************************/
+static void Decode_PrintBits(unsigned long Value, const Decode_BitType * Bits, unsigned int Count)
+{
+    unsigned int index;
+
+    for(index = 0; index < Count; index++)
+    {
+        if(Value & (1UL << Bits[index].Bit))
+        {
+            printf("    %-12s %s\n", Bits[index].Name, Bits[index].Meaning);
+        }
+    }
+}
+
+/*********************************************************************************************/
+static const char * Decode_ExceptionName(unsigned long Exception)
+{
+    switch(Exception)
+    {
+        case 3:  return "HardFault";
+        case 4:  return "MemManage";
+        case 5:  return "BusFault";
+        case 6:  return "UsageFault";
+        default: return "unexpected exception";
+    }
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    unsigned long cfsr;
+    unsigned long exc_return;
+    unsigned int index;
+
+    if(argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <record file>\n", argv[0]);
+        return 1;
+    }
+    if(!Decode_ReadRecord(argv[1]))
+    {
+        return 1;
+    }
+    if(g_Record[REC_SIGNATURE] != FAULT_RECORD_SIGNATURE)
+    {
+        fprintf(stderr, "Fault_Decode: no crash record (signature 0x%08lX)\n", g_Record[REC_SIGNATURE]);
+        return 1;
+    }
+    if(g_Record[REC_CHECKSUM] != Decode_Checksum())
+    {
+        printf("Warning: checksum mismatch, the record is incomplete or was overwritten\n");
+    }
+
+    cfsr = g_Record[REC_CFSR];
+    exc_return = g_Record[REC_EXC_RETURN];
+
+    printf("%s (exception %lu), fault number %lu since the record was cleared\n",
+           Decode_ExceptionName(g_Record[REC_EXCEPTION]), g_Record[REC_EXCEPTION], g_Record[REC_COUNT]);
+    printf("EXC_RETURN 0x%08lX: %s mode, %s stack, %s frame\n", exc_return,
+           (exc_return & 0x8UL) ? "thread" : "handler",
+           (exc_return & 0x4UL) ? "process" : "main",
+           (exc_return & 0x10UL) ? "basic" : "FPU");
+
+    printf("\nStacked registers:\n");
+    for(index = 0; index < 8; index++)
+    {
+        printf("    %-4s 0x%08lX\n", g_Frame_Names[index], g_Record[REC_FRAME + index]);
+    }
+    printf("    SP   0x%08lX (before the exception)\n", g_Record[REC_STACK_POINTER]);
+
+    printf("\nCFSR 0x%08lX\n", cfsr);
+    Decode_PrintBits(cfsr, g_Cfsr_Bits, sizeof(g_Cfsr_Bits) / sizeof(g_Cfsr_Bits[0]));
+    if(cfsr & (1UL << 7))
+    {
+        printf("    MMFAR        0x%08lX\n", g_Record[REC_MMFAR]);
+    }
+    if(cfsr & (1UL << 15))
+    {
+        printf("    BFAR         0x%08lX\n", g_Record[REC_BFAR]);
+    }
+    printf("HFSR 0x%08lX\n", g_Record[REC_HFSR]);
+    Decode_PrintBits(g_Record[REC_HFSR], g_Hfsr_Bits, sizeof(g_Hfsr_Bits) / sizeof(g_Hfsr_Bits[0]));
+
+    printf("\nStack above the frame:\n");
+    for(index = 0; index < FAULT_STACK_WINDOW_WORDS; index++)
+    {
+        printf("    0x%08lX: 0x%08lX\n", g_Record[REC_STACK_POINTER] + (4UL * index), g_Record[REC_STACK + index]);
+    }
+
+    printf("\nLook up PC (faulting instruction) and LR (caller) in the .map file or with the disassembly.\n");
+    return 0;
+}
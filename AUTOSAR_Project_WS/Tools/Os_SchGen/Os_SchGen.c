@@ -0,0 +1,517 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_SchGen.c
+ *
+ * Description: Host tool which generates the Os schedule table (Os_SchTbl_PBcfg.c)
+ *              from the task periods and worst case execution times.
+ *
+ *              The release offset of each periodic task is chosen to minimize the
+ *              highest load of a single Os tick (frame) over the hyper-period, the
+ *              sum of the squared frame loads is used to break the ties.
+ *
+ *              Build : gcc -std=c99 -Wall -o Os_SchGen Os_SchGen.c
+ *              Usage : Os_SchGen <tasks file> <output file>
+ *
+ *              Tasks file format (one entry per line, '#' starts a comment):
+ *                  tick <Os tick in ms>
+ *                  task <Task Id macro> <period in ms> <wcet in us>
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum number of tasks activated by the table (size of the Os task mask) */
+#define SCHGEN_MAX_TASKS            (32U)
+
+/* Maximum hyper-period in Os ticks (number of frames of the schedule table) */
+#define SCHGEN_MAX_FRAMES           (4096U)
+
+/* Above this number of offset combinations the search is greedy instead of exhaustive */
+#define SCHGEN_EXHAUSTIVE_LIMIT     (1000000UL)
+
+/* Maximum number of improvement passes after the greedy placement */
+#define SCHGEN_MAX_PASSES           (100U)
+
+/* Maximum length of a Task Id macro name */
+#define SCHGEN_MAX_NAME             (64U)
+
+typedef struct
+{
+    char Name[SCHGEN_MAX_NAME];
+    unsigned long Period;       /* in Os ticks */
+    unsigned long Wcet;         /* in us */
+    unsigned long Offset;       /* in Os ticks, 0 .. Period-1 */
+    unsigned int Bit;           /* position of the task in the input file */
+}SchGen_TaskType;
+
+typedef struct
+{
+    unsigned long Peak;
+    unsigned long long SumOfSquares;
+}SchGen_CostType;
+
+static SchGen_TaskType g_Tasks[SCHGEN_MAX_TASKS];
+static unsigned int g_Number_Of_Tasks = 0;
+static unsigned long g_Tick_Ms = 0;
+static unsigned long g_Frames = 0;
+
+/* Load of each frame in us for the offsets being evaluated */
+static unsigned long g_Frame_Load[SCHGEN_MAX_FRAMES];
+
+/* Best offsets found by the search */
+static unsigned long g_Best_Offset[SCHGEN_MAX_TASKS];
+static SchGen_CostType g_Best_Cost;
+
+/*********************************************************************************************/
+static unsigned long SchGen_Gcd(unsigned long a, unsigned long b)
+{
+    unsigned long t;
+
+    while(b != 0)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/*********************************************************************************************/
+/* Description: Add (Sign = 1) or remove (Sign = -1) the wcet of the task to its release frames */
+static void SchGen_PlaceTask(const SchGen_TaskType * Task, unsigned long Offset, int Sign)
+{
+    unsigned long frame;
+
+    for(frame = Offset; frame < g_Frames; frame += Task->Period)
+    {
+        if(Sign > 0)
+        {
+            g_Frame_Load[frame] += Task->Wcet;
+        }
+        else
+        {
+            g_Frame_Load[frame] -= Task->Wcet;
+        }
+    }
+}
+
+/*********************************************************************************************/
+static SchGen_CostType SchGen_Cost(void)
+{
+    SchGen_CostType cost = {0, 0};
+    unsigned long frame;
+
+    for(frame = 0; frame < g_Frames; frame++)
+    {
+        if(g_Frame_Load[frame] > cost.Peak)
+        {
+            cost.Peak = g_Frame_Load[frame];
+        }
+        cost.SumOfSquares += (unsigned long long)g_Frame_Load[frame] * g_Frame_Load[frame];
+    }
+    return cost;
+}
+
+/*********************************************************************************************/
+static int SchGen_CostIsLower(SchGen_CostType A, SchGen_CostType B)
+{
+    return (A.Peak < B.Peak) || ((A.Peak == B.Peak) && (A.SumOfSquares < B.SumOfSquares));
+}
+
+/*********************************************************************************************/
+static unsigned long SchGen_PeakOfOffsets(const unsigned long * Offsets)
+{
+    unsigned int task;
+    SchGen_CostType cost;
+
+    memset(g_Frame_Load, 0, sizeof(g_Frame_Load));
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        SchGen_PlaceTask(&g_Tasks[task], Offsets[task], 1);
+    }
+    cost = SchGen_Cost();
+    return cost.Peak;
+}
+
+/*********************************************************************************************/
+/* Description: Try every offset of the remaining tasks, prune when the peak already exceeds the best one */
+static void SchGen_Search(unsigned int Task)
+{
+    unsigned long offset;
+    unsigned long last_offset;
+    SchGen_CostType cost;
+
+    if(Task == g_Number_Of_Tasks)
+    {
+        cost = SchGen_Cost();
+        if(SchGen_CostIsLower(cost, g_Best_Cost))
+        {
+            g_Best_Cost = cost;
+            for(Task = 0; Task < g_Number_Of_Tasks; Task++)
+            {
+                g_Best_Offset[Task] = g_Tasks[Task].Offset;
+            }
+        }
+        return;
+    }
+
+    /* Shifting all the offsets rotates the frame loads only ... the first task is kept at offset 0 */
+    last_offset = (Task == 0) ? 0 : (g_Tasks[Task].Period - 1);
+
+    for(offset = 0; offset <= last_offset; offset++)
+    {
+        SchGen_PlaceTask(&g_Tasks[Task], offset, 1);
+        g_Tasks[Task].Offset = offset;
+        cost = SchGen_Cost();
+        if(cost.Peak <= g_Best_Cost.Peak)
+        {
+            SchGen_Search(Task + 1);
+        }
+        SchGen_PlaceTask(&g_Tasks[Task], offset, -1);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Move the task to the offset with the lowest cost, return 1 if the cost improved */
+static int SchGen_ImproveTask(unsigned int Task)
+{
+    unsigned long offset;
+    unsigned long best_offset = g_Tasks[Task].Offset;
+    SchGen_CostType cost;
+    SchGen_CostType best_cost;
+
+    best_cost = SchGen_Cost();
+    SchGen_PlaceTask(&g_Tasks[Task], g_Tasks[Task].Offset, -1);
+
+    for(offset = 0; offset < g_Tasks[Task].Period; offset++)
+    {
+        SchGen_PlaceTask(&g_Tasks[Task], offset, 1);
+        cost = SchGen_Cost();
+        if(SchGen_CostIsLower(cost, best_cost))
+        {
+            best_cost = cost;
+            best_offset = offset;
+        }
+        SchGen_PlaceTask(&g_Tasks[Task], offset, -1);
+    }
+
+    SchGen_PlaceTask(&g_Tasks[Task], best_offset, 1);
+    if(best_offset != g_Tasks[Task].Offset)
+    {
+        g_Tasks[Task].Offset = best_offset;
+        return 1;
+    }
+    return 0;
+}
+
+/*********************************************************************************************/
+/* Description: Place the tasks one by one at their best offset then refine until no move helps */
+static void SchGen_Greedy(void)
+{
+    unsigned int task;
+    unsigned int pass;
+    int improved = 1;
+
+    memset(g_Frame_Load, 0, sizeof(g_Frame_Load));
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        /* Start from an empty placement ... an offset of 0 is evaluated first by SchGen_ImproveTask */
+        g_Tasks[task].Offset = 0;
+        SchGen_PlaceTask(&g_Tasks[task], 0, 1);
+        (void)SchGen_ImproveTask(task);
+    }
+
+    for(pass = 0; (pass < SCHGEN_MAX_PASSES) && improved; pass++)
+    {
+        improved = 0;
+        for(task = 0; task < g_Number_Of_Tasks; task++)
+        {
+            improved |= SchGen_ImproveTask(task);
+        }
+    }
+
+    g_Best_Cost = SchGen_Cost();
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        g_Best_Offset[task] = g_Tasks[task].Offset;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Sort the tasks by decreasing wcet so the search prunes early */
+static int SchGen_CompareTasks(const void * A, const void * B)
+{
+    const SchGen_TaskType * a = (const SchGen_TaskType *)A;
+    const SchGen_TaskType * b = (const SchGen_TaskType *)B;
+
+    if(a->Wcet != b->Wcet)
+    {
+        return (a->Wcet > b->Wcet) ? -1 : 1;
+    }
+    if(a->Period != b->Period)
+    {
+        return (a->Period < b->Period) ? -1 : 1;
+    }
+    return (a->Bit < b->Bit) ? -1 : 1;
+}
+
+/*********************************************************************************************/
+/* Description: Sort the tasks back to the order of the tasks file */
+static int SchGen_CompareTasksByBit(const void * A, const void * B)
+{
+    return (((const SchGen_TaskType *)A)->Bit < ((const SchGen_TaskType *)B)->Bit) ? -1 : 1;
+}
+
+/*********************************************************************************************/
+static int SchGen_ReadTasks(const char * FileName)
+{
+    FILE * file = fopen(FileName, "r");
+    char line[256];
+    char keyword[16];
+    char name[SCHGEN_MAX_NAME];
+    unsigned long period;
+    unsigned long wcet;
+    unsigned int line_number = 0;
+    char * comment;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "Os_SchGen: cannot open %s\n", FileName);
+        return 0;
+    }
+
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        comment = strchr(line, '#');
+        if(comment != NULL)
+        {
+            *comment = '\0';
+        }
+        if(sscanf(line, "%15s", keyword) != 1)
+        {
+            continue;
+        }
+
+        if((strcmp(keyword, "tick") == 0) && (sscanf(line, "%*s %lu", &g_Tick_Ms) == 1) && (g_Tick_Ms != 0))
+        {
+            continue;
+        }
+        if((strcmp(keyword, "task") == 0) && (g_Tick_Ms != 0) && (g_Number_Of_Tasks < SCHGEN_MAX_TASKS)
+        && (sscanf(line, "%*s %63s %lu %lu", name, &period, &wcet) == 3)
+        && (period != 0) && ((period % g_Tick_Ms) == 0))
+        {
+            strcpy(g_Tasks[g_Number_Of_Tasks].Name, name);
+            g_Tasks[g_Number_Of_Tasks].Period = period / g_Tick_Ms;
+            g_Tasks[g_Number_Of_Tasks].Wcet   = wcet;
+            g_Tasks[g_Number_Of_Tasks].Offset = 0;
+            g_Tasks[g_Number_Of_Tasks].Bit    = g_Number_Of_Tasks;
+            g_Number_Of_Tasks++;
+            continue;
+        }
+
+        fprintf(stderr, "Os_SchGen: %s:%u: invalid entry (tick must come first, periods must be multiples of it)\n",
+                FileName, line_number);
+        fclose(file);
+        return 0;
+    }
+    fclose(file);
+
+    if(g_Number_Of_Tasks == 0)
+    {
+        fprintf(stderr, "Os_SchGen: %s: no task\n", FileName);
+        return 0;
+    }
+    return 1;
+}
+
+/*********************************************************************************************/
+static void SchGen_PrintLoad(const char * Title, const unsigned long * Offsets)
+{
+    unsigned int task;
+    unsigned long frame;
+    unsigned long peak = SchGen_PeakOfOffsets(Offsets);
+
+    printf("%s\n", Title);
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        printf("    %-24s period %4lu ms  wcet %6lu us  offset %4lu ms\n", g_Tasks[task].Name,
+               g_Tasks[task].Period * g_Tick_Ms, g_Tasks[task].Wcet, Offsets[task] * g_Tick_Ms);
+    }
+    printf("    frame load (us):");
+    for(frame = 0; frame < g_Frames; frame++)
+    {
+        printf(" %lu", g_Frame_Load[frame]);
+    }
+    printf("\n    worst case frame load: %lu us (%lu.%02lu %% of the %lu ms tick)\n\n", peak,
+           peak / (g_Tick_Ms * 10UL), ((peak * 100UL) / (g_Tick_Ms * 10UL)) % 100UL, g_Tick_Ms);
+}
+
+/*********************************************************************************************/
+/* Description: fprintf with CRLF line ends, like the other project sources, on every host */
+static void SchGen_Print(FILE * File, const char * Format, ...)
+{
+    char text[4096];
+    const char * character;
+    va_list args;
+
+    va_start(args, Format);
+    vsnprintf(text, sizeof(text), Format, args);
+    va_end(args);
+    for(character = text; *character != '\0'; character++)
+    {
+        if(*character == '\n')
+        {
+            fputc('\r', File);
+        }
+        fputc(*character, File);
+    }
+}
+
+/*********************************************************************************************/
+static int SchGen_WriteTable(const char * FileName)
+{
+    FILE * file = fopen(FileName, "wb");
+    unsigned long frame;
+    unsigned long points = 0;
+    unsigned int task;
+    int first;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "Os_SchGen: cannot create %s\n", FileName);
+        return 0;
+    }
+
+    SchGen_Print(file,
+        " /******************************************************************************\n"
+        " *\n"
+        " * Module: Os\n"
+        " *\n"
+        " * File Name: Os_SchTbl_PBcfg.c\n"
+        " *\n"
+        " * Description: Schedule table of the periodic tasks generated by Tools/Os_SchGen,\n"
+        " *              do not edit ... update Os_SchGen_Tasks.txt and run the tool again.\n"
+        " *              Worst case frame load: %lu us per %lu ms tick.\n"
+        " *\n"
+        " * Author: Mohamed Tarek\n"
+        " ******************************************************************************/\n"
+        "\n"
+        "#include \"Os.h\"\n"
+        "\n"
+        "/* Expiry points of OS_SCHTBL_PERIODIC --> Offset (in Os ticks), Mask of the activated tasks */\n"
+        "static const Os_ExpiryPointType Os_SchTbl_Periodic_ExpiryPoints[] = {\n",
+        g_Best_Cost.Peak, g_Tick_Ms);
+
+    for(frame = 0; frame < g_Frames; frame++)
+    {
+        first = 1;
+        for(task = 0; task < g_Number_Of_Tasks; task++)
+        {
+            if((frame % g_Tasks[task].Period) != g_Best_Offset[task])
+            {
+                continue;
+            }
+            if(first)
+            {
+                SchGen_Print(file, "%s    {%lu, ", (points == 0) ? "" : ",\n", frame);
+                points++;
+            }
+            else
+            {
+                SchGen_Print(file, " | ");
+            }
+            SchGen_Print(file, "OS_TASK_MASK(%s)", g_Tasks[task].Name);
+            first = 0;
+        }
+        if(!first)
+        {
+            SchGen_Print(file, "}");
+        }
+    }
+
+    SchGen_Print(file,
+        "\n};\n"
+        "\n"
+        "/* Os schedule tables ordered by Schedule Table Id --> Counter, Duration, Repeating, Expiry points,\n"
+        " * Number of expiry points, Autostart offset (0 if not started by Os_start) */\n"
+        "const Os_ScheduleTableConfigType Os_ScheduleTableConfig[OS_NUMBER_OF_SCHEDULE_TABLES] = {\n"
+        "    {OS_COUNTER_SYSTEM, %lu, TRUE, Os_SchTbl_Periodic_ExpiryPoints, %lu, 1}   /* OS_SCHTBL_PERIODIC */\n"
+        "};\n",
+        g_Frames, points);
+
+    fclose(file);
+    return 1;
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    unsigned long offsets[SCHGEN_MAX_TASKS];
+    unsigned long combinations = 1;
+    unsigned int task;
+
+    if(argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <tasks file> <output file>\n", argv[0]);
+        return 1;
+    }
+    if(!SchGen_ReadTasks(argv[1]))
+    {
+        return 1;
+    }
+
+    /* The schedule table duration is the hyper-period of the tasks */
+    g_Frames = 1;
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        g_Frames = (g_Frames / SchGen_Gcd(g_Frames, g_Tasks[task].Period)) * g_Tasks[task].Period;
+        if(g_Frames > SCHGEN_MAX_FRAMES)
+        {
+            fprintf(stderr, "Os_SchGen: hyper-period exceeds %u ticks\n", SCHGEN_MAX_FRAMES);
+            return 1;
+        }
+    }
+
+    /* Before: each task is first released one period after the start, as the autostart alarms did */
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        offsets[task] = g_Tasks[task].Period - 1;
+    }
+    SchGen_PrintLoad("Before (release at the end of the first period):", offsets);
+
+    qsort(g_Tasks, g_Number_Of_Tasks, sizeof(g_Tasks[0]), SchGen_CompareTasks);
+    for(task = 0; (task < g_Number_Of_Tasks) && (combinations <= SCHGEN_EXHAUSTIVE_LIMIT); task++)
+    {
+        combinations *= g_Tasks[task].Period;
+    }
+
+    /* The greedy result is the starting bound of the exhaustive search */
+    SchGen_Greedy();
+    if(combinations <= SCHGEN_EXHAUSTIVE_LIMIT)
+    {
+        memset(g_Frame_Load, 0, sizeof(g_Frame_Load));
+        SchGen_Search(0);
+    }
+
+    /* Restore the input order for the report and the generated table */
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        g_Tasks[task].Offset = g_Best_Offset[task];
+    }
+    qsort(g_Tasks, g_Number_Of_Tasks, sizeof(g_Tasks[0]), SchGen_CompareTasksByBit);
+    for(task = 0; task < g_Number_Of_Tasks; task++)
+    {
+        g_Best_Offset[task] = g_Tasks[task].Offset;
+    }
+    SchGen_PrintLoad(combinations <= SCHGEN_EXHAUSTIVE_LIMIT ? "After (exhaustive search):" : "After (greedy search):",
+                     g_Best_Offset);
+
+    return SchGen_WriteTable(argv[2]) ? 0 : 1;
+}
@@ -0,0 +1,488 @@
+ /******************************************************************************
+ *
+ * Module: Rte
+ *
+ * File Name: Rte_Gen.c
+ *
+ * Description: Host tool which generates the Rte signal buffers (Rte.h and Rte.c)
+ *              from a description of the sender-receiver interfaces and ports.
+ *
+ *              Each interface gets one statically allocated buffer written by its
+ *              provided port and one data-changed flag per required port. The
+ *              Rte_Write_/Rte_Read_/Rte_IsUpdated_ accessors are inline functions
+ *              in Rte.h, they compile to plain loads and stores.
+ *
+ *              Build : gcc -std=c99 -Wall -o Rte_Gen Rte_Gen.c
+ *              Usage : Rte_Gen <ports file> <output folder>
+ *
+ *              Ports file format (one entry per line, '#' starts a comment):
+ *                  include   <header declaring the initial values>
+ *                  interface <Interface> <data type> <initial value>
+ *                  port      <Component> provided|required <Port> <Interface>
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum number of interfaces, ports and included headers */
+#define RTEGEN_MAX_INTERFACES       (64U)
+#define RTEGEN_MAX_PORTS            (128U)
+#define RTEGEN_MAX_INCLUDES         (16U)
+
+/* Maximum length of a name or an initial value */
+#define RTEGEN_MAX_NAME             (64U)
+
+/* Data types of the buffers ... at most 32 bits so the accesses are single loads and stores */
+static const char * const g_Data_Types[] = {
+    "boolean", "uint8", "uint16", "uint32", "sint8", "sint16", "sint32"
+};
+
+typedef struct
+{
+    char Name[RTEGEN_MAX_NAME];
+    char Type[RTEGEN_MAX_NAME];
+    char Init[RTEGEN_MAX_NAME];
+    int Provider;                       /* index of the provided port, -1 if none */
+    unsigned int Readers;               /* number of required ports */
+}RteGen_InterfaceType;
+
+typedef struct
+{
+    char Component[RTEGEN_MAX_NAME];
+    char Name[RTEGEN_MAX_NAME];
+    int Provided;
+    unsigned int Interface;
+    unsigned int Reader;                /* index of the data-changed flag of a required port */
+}RteGen_PortType;
+
+static RteGen_InterfaceType g_Interfaces[RTEGEN_MAX_INTERFACES];
+static unsigned int g_Number_Of_Interfaces = 0;
+static RteGen_PortType g_Ports[RTEGEN_MAX_PORTS];
+static unsigned int g_Number_Of_Ports = 0;
+static char g_Includes[RTEGEN_MAX_INCLUDES][RTEGEN_MAX_NAME];
+static unsigned int g_Number_Of_Includes = 0;
+
+/*********************************************************************************************/
+static int RteGen_FindInterface(const char * Name)
+{
+    unsigned int index;
+
+    for(index = 0; index < g_Number_Of_Interfaces; index++)
+    {
+        if(strcmp(g_Interfaces[index].Name, Name) == 0)
+        {
+            return (int)index;
+        }
+    }
+    return -1;
+}
+
+/*********************************************************************************************/
+static int RteGen_IsDataType(const char * Type)
+{
+    unsigned int index;
+
+    for(index = 0; index < sizeof(g_Data_Types) / sizeof(g_Data_Types[0]); index++)
+    {
+        if(strcmp(g_Data_Types[index], Type) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*********************************************************************************************/
+/* Description: Check that a name can be used in the C identifiers of the accessors */
+static int RteGen_IsName(const char * Name)
+{
+    const char * c;
+
+    if((Name[0] >= '0') && (Name[0] <= '9'))
+    {
+        return 0;
+    }
+    for(c = Name; *c != '\0'; c++)
+    {
+        if(!(((*c >= 'a') && (*c <= 'z')) || ((*c >= 'A') && (*c <= 'Z')) || ((*c >= '0') && (*c <= '9'))))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*********************************************************************************************/
+/* Description: Read an entry, return 0 with the reason in Error if it is invalid */
+static int RteGen_ReadEntry(const char * Line, const char * Keyword, const char ** Error)
+{
+    char name[RTEGEN_MAX_NAME];
+    char type[RTEGEN_MAX_NAME];
+    char init[RTEGEN_MAX_NAME];
+    char direction[16];
+    RteGen_InterfaceType * interface;
+    RteGen_PortType * port;
+    int index;
+
+    if(strcmp(Keyword, "include") == 0)
+    {
+        if((g_Number_Of_Includes >= RTEGEN_MAX_INCLUDES) || (sscanf(Line, "%*s %63s", name) != 1))
+        {
+            *Error = "include <header>";
+            return 0;
+        }
+        strcpy(g_Includes[g_Number_Of_Includes++], name);
+        return 1;
+    }
+
+    if(strcmp(Keyword, "interface") == 0)
+    {
+        if((g_Number_Of_Interfaces >= RTEGEN_MAX_INTERFACES) || (sscanf(Line, "%*s %63s %63s %63s", name, type, init) != 3))
+        {
+            *Error = "interface <Interface> <data type> <initial value>";
+            return 0;
+        }
+        if(!RteGen_IsName(name) || (RteGen_FindInterface(name) >= 0))
+        {
+            *Error = "invalid or duplicated interface name";
+            return 0;
+        }
+        if(!RteGen_IsDataType(type))
+        {
+            *Error = "the data type must be boolean, uint8, uint16, uint32, sint8, sint16 or sint32";
+            return 0;
+        }
+        interface = &g_Interfaces[g_Number_Of_Interfaces++];
+        strcpy(interface->Name, name);
+        strcpy(interface->Type, type);
+        strcpy(interface->Init, init);
+        interface->Provider = -1;
+        interface->Readers  = 0;
+        return 1;
+    }
+
+    if(strcmp(Keyword, "port") == 0)
+    {
+        if((g_Number_Of_Ports >= RTEGEN_MAX_PORTS)
+        || (sscanf(Line, "%*s %63s %15s %63s %63s", name, direction, type, init) != 4))
+        {
+            *Error = "port <Component> provided|required <Port> <Interface>";
+            return 0;
+        }
+        index = RteGen_FindInterface(init);
+        if(index < 0)
+        {
+            *Error = "the interface must be declared before its ports";
+            return 0;
+        }
+        if(!RteGen_IsName(name) || !RteGen_IsName(type))
+        {
+            *Error = "invalid component or port name";
+            return 0;
+        }
+        port = &g_Ports[g_Number_Of_Ports];
+        strcpy(port->Component, name);
+        strcpy(port->Name, type);
+        port->Interface = (unsigned int)index;
+        interface = &g_Interfaces[index];
+        if(strcmp(direction, "provided") == 0)
+        {
+            if(interface->Provider >= 0)
+            {
+                *Error = "an interface has a single provided port";
+                return 0;
+            }
+            port->Provided = 1;
+            interface->Provider = (int)g_Number_Of_Ports;
+        }
+        else if(strcmp(direction, "required") == 0)
+        {
+            port->Provided = 0;
+            port->Reader   = interface->Readers++;
+        }
+        else
+        {
+            *Error = "the port direction must be provided or required";
+            return 0;
+        }
+        g_Number_Of_Ports++;
+        return 1;
+    }
+
+    *Error = "unknown keyword";
+    return 0;
+}
+
+/*********************************************************************************************/
+static int RteGen_ReadPorts(const char * FileName)
+{
+    FILE * file = fopen(FileName, "r");
+    char line[256];
+    char keyword[16];
+    unsigned int line_number = 0;
+    unsigned int index;
+    const char * error = "";
+    char * comment;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "Rte_Gen: cannot open %s\n", FileName);
+        return 0;
+    }
+
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        comment = strchr(line, '#');
+        if(comment != NULL)
+        {
+            *comment = '\0';
+        }
+        if(sscanf(line, "%15s", keyword) != 1)
+        {
+            continue;
+        }
+        if(!RteGen_ReadEntry(line, keyword, &error))
+        {
+            fprintf(stderr, "Rte_Gen: %s:%u: %s\n", FileName, line_number, error);
+            fclose(file);
+            return 0;
+        }
+    }
+    fclose(file);
+
+    for(index = 0; index < g_Number_Of_Interfaces; index++)
+    {
+        if((g_Interfaces[index].Provider < 0) || (g_Interfaces[index].Readers == 0))
+        {
+            fprintf(stderr, "Rte_Gen: %s: interface %s needs a provided port and at least one required port\n",
+                    FileName, g_Interfaces[index].Name);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*********************************************************************************************/
+/* Description: fprintf with CRLF line ends, like the other project sources, on every host */
+static void RteGen_Print(FILE * File, const char * Format, ...)
+{
+    char text[4096];
+    const char * character;
+    va_list args;
+
+    va_start(args, Format);
+    vsnprintf(text, sizeof(text), Format, args);
+    va_end(args);
+    for(character = text; *character != '\0'; character++)
+    {
+        if(*character == '\n')
+        {
+            fputc('\r', File);
+        }
+        fputc(*character, File);
+    }
+}
+
+/*********************************************************************************************/
+static void RteGen_WriteFileHeader(FILE * File, const char * FileName, const char * Description)
+{
+    RteGen_Print(File,
+        " /******************************************************************************\n"
+        " *\n"
+        " * Module: Rte\n"
+        " *\n"
+        " * File Name: %s\n"
+        " *\n"
+        " * Description: %s generated by Tools/Rte_Gen,\n"
+        " *              do not edit ... update Rte_Gen_Ports.txt and run the tool again.\n"
+        " *\n"
+        " * Author: Mohamed Tarek\n"
+        " ******************************************************************************/\n"
+        "\n",
+        FileName, Description);
+}
+
+/*********************************************************************************************/
+/* Description: Print the readers of an interface as "Led.State, App.Brightness" */
+static void RteGen_WriteReaders(FILE * File, unsigned int Interface)
+{
+    unsigned int port;
+    int first = 1;
+
+    for(port = 0; port < g_Number_Of_Ports; port++)
+    {
+        if(!g_Ports[port].Provided && (g_Ports[port].Interface == Interface))
+        {
+            RteGen_Print(File, "%s%s.%s", first ? "" : ", ", g_Ports[port].Component, g_Ports[port].Name);
+            first = 0;
+        }
+    }
+}
+
+/*********************************************************************************************/
+static int RteGen_WriteHeader(const char * Folder)
+{
+    char file_name[512];
+    FILE * file;
+    const RteGen_InterfaceType * interface;
+    const RteGen_PortType * port;
+    unsigned int index;
+    unsigned int reader;
+
+    sprintf(file_name, "%s/Rte.h", Folder);
+    file = fopen(file_name, "wb");
+    if(file == NULL)
+    {
+        fprintf(stderr, "Rte_Gen: cannot create %s\n", file_name);
+        return 0;
+    }
+
+    RteGen_WriteFileHeader(file, "Rte.h", "Signal buffers and accessors between the tasks");
+    RteGen_Print(file,
+        "#ifndef RTE_H\n"
+        "#define RTE_H\n"
+        "\n"
+        "#include \"Std_Types.h\"\n");
+    for(index = 0; index < g_Number_Of_Includes; index++)
+    {
+        RteGen_Print(file, "#include \"%s\"\n", g_Includes[index]);
+    }
+    RteGen_Print(file,
+        "\n"
+        "/* Status returned by the Rte accessors */\n"
+        "#define RTE_E_OK                ((Std_ReturnType)0x00U)\n"
+        "\n"
+        "/*******************************************************************************\n"
+        " *                      Signal Buffers (Rte.c)                                 *\n"
+        " *******************************************************************************/\n");
+    for(index = 0; index < g_Number_Of_Interfaces; index++)
+    {
+        interface = &g_Interfaces[index];
+        RteGen_Print(file, "\n/* %s: %s.%s --> ", interface->Name,
+                g_Ports[interface->Provider].Component, g_Ports[interface->Provider].Name);
+        RteGen_WriteReaders(file, index);
+        RteGen_Print(file, " */\n"
+                      "extern volatile %s Rte_Buffer_%s;\n"
+                      "extern volatile boolean Rte_Changed_%s[%u];\n",
+                interface->Type, interface->Name, interface->Name, interface->Readers);
+    }
+
+    RteGen_Print(file,
+        "\n"
+        "/*******************************************************************************\n"
+        " *                      Accessors                                              *\n"
+        " *******************************************************************************/\n");
+    for(index = 0; index < g_Number_Of_Ports; index++)
+    {
+        port = &g_Ports[index];
+        interface = &g_Interfaces[port->Interface];
+        if(port->Provided)
+        {
+            /* The data-changed flags are only set by a new value */
+            RteGen_Print(file,
+                "\n"
+                "/* Description: Write %s from %s, the readers see it as changed if the value is new */\n"
+                "LOCAL_INLINE Std_ReturnType Rte_Write_%s_%s(%s Data)\n"
+                "{\n"
+                "    if(Rte_Buffer_%s != Data)\n"
+                "    {\n"
+                "        Rte_Buffer_%s = Data;\n",
+                interface->Name, port->Component, port->Component, port->Name, interface->Type,
+                interface->Name, interface->Name);
+            for(reader = 0; reader < interface->Readers; reader++)
+            {
+                RteGen_Print(file, "        Rte_Changed_%s[%u] = TRUE;\n", interface->Name, reader);
+            }
+            RteGen_Print(file,
+                "    }\n"
+                "    return RTE_E_OK;\n"
+                "}\n");
+        }
+        else
+        {
+            /* The flag is cleared before the load: a value written in between sets it again */
+            RteGen_Print(file,
+                "\n"
+                "/* Description: Read %s in %s and clear its data-changed flag */\n"
+                "LOCAL_INLINE Std_ReturnType Rte_Read_%s_%s(%s * Data)\n"
+                "{\n"
+                "    Rte_Changed_%s[%u] = FALSE;\n"
+                "    *Data = Rte_Buffer_%s;\n"
+                "    return RTE_E_OK;\n"
+                "}\n"
+                "\n"
+                "/* Description: TRUE if %s changed since its last read in %s */\n"
+                "LOCAL_INLINE boolean Rte_IsUpdated_%s_%s(void)\n"
+                "{\n"
+                "    return Rte_Changed_%s[%u];\n"
+                "}\n",
+                interface->Name, port->Component, port->Component, port->Name, interface->Type,
+                interface->Name, port->Reader, interface->Name,
+                interface->Name, port->Component, port->Component, port->Name,
+                interface->Name, port->Reader);
+        }
+    }
+    RteGen_Print(file, "\n#endif /* RTE_H */\n");
+    fclose(file);
+    return 1;
+}
+
+/*********************************************************************************************/
+static int RteGen_WriteSource(const char * Folder)
+{
+    char file_name[512];
+    FILE * file;
+    const RteGen_InterfaceType * interface;
+    unsigned int index;
+    unsigned int reader;
+
+    sprintf(file_name, "%s/Rte.c", Folder);
+    file = fopen(file_name, "wb");
+    if(file == NULL)
+    {
+        fprintf(stderr, "Rte_Gen: cannot create %s\n", file_name);
+        return 0;
+    }
+
+    RteGen_WriteFileHeader(file, "Rte.c", "Signal buffers between the tasks");
+    RteGen_Print(file,
+        "#include \"Rte.h\"\n"
+        "\n"
+        "/* Signal buffers with their initial value and the data-changed flag of each reader */\n");
+    for(index = 0; index < g_Number_Of_Interfaces; index++)
+    {
+        interface = &g_Interfaces[index];
+        RteGen_Print(file, "volatile %s Rte_Buffer_%s = %s;\n"
+                      "volatile boolean Rte_Changed_%s[%u] = {",
+                interface->Type, interface->Name, interface->Init, interface->Name, interface->Readers);
+        for(reader = 0; reader < interface->Readers; reader++)
+        {
+            RteGen_Print(file, "%sFALSE", (reader == 0) ? "" : ", ");
+        }
+        RteGen_Print(file, "};\n");
+    }
+    fclose(file);
+    return 1;
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    if(argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <ports file> <output folder>\n", argv[0]);
+        return 1;
+    }
+    if(!RteGen_ReadPorts(argv[1]))
+    {
+        return 1;
+    }
+
+    printf("%u interfaces, %u ports\n", g_Number_Of_Interfaces, g_Number_Of_Ports);
+    return (RteGen_WriteHeader(argv[2]) && RteGen_WriteSource(argv[2])) ? 0 : 1;
+}
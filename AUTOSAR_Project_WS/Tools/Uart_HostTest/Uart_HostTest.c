@@ -0,0 +1,511 @@
+ /******************************************************************************
+ *
+ * Module: Uart
+ *
+ * File Name: Uart_HostTest.c
+ *
+ * Description: Host test of the Uart Driver (AUTOSAR_Project/Uart.c) on a simulated
+ *              register block: the baud rate divisors, the transmit and receive rings,
+ *              the FIFO levels, the receive timeout, the overflow and line errors and
+ *              the wrap of the free running ring indexes.
+ *
+ *              Build : gcc -std=c99 -Wall -I../../AUTOSAR_Project -o Uart_HostTest Uart_HostTest.c
+ *              Usage : Uart_HostTest
+ *
+ *              UART_REG of Uart_Regs.h is replaced by UartSim_Reg which returns the word of a
+ *              simulated UART. The data register access is only known after it is done, so
+ *              each access first settles the previous one: the word of DR is returned with
+ *              UART_SIM_READ_MARK set, it is still set after a read (pop of the RX FIFO) and
+ *              cleared by a write of a byte (push to the TX FIFO).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Std_Types.h"
+
+/* Number of the simulated UART modules and size of their register blocks in words */
+#define UART_SIM_UNITS              (8U)
+#define UART_SIM_BLOCK_WORDS        (0x1000U / 4U)
+
+/* Depth of the hardware FIFOs */
+#define UART_SIM_FIFO_SIZE          (16U)
+
+/* Marker of the value returned by a data register read, a written byte clears it */
+#define UART_SIM_READ_MARK          (0x80000000UL)
+
+/* Peripheral interrupt of UART0 (Uart_HwIrq in Uart.c) */
+#define UART_SIM_UART0_IRQ          (5U)
+
+static volatile uint32 * UartSim_Reg(uint32 Base, uint32 Offset);
+
+/* The driver accesses the simulated registers, its clock is gated on at once */
+#define UART_REG(BASE,OFFSET)       (*UartSim_Reg((BASE), (OFFSET)))
+#define UART_SYSCTL_RCGCUART_REG    g_Sim_Rcgc
+#define UART_SYSCTL_PRUART_REG      g_Sim_Rcgc
+
+static volatile uint32 g_Sim_Rcgc = 0;
+
+#include "Uart.c"
+
+typedef struct
+{
+    uint32 Regs[UART_SIM_BLOCK_WORDS];
+    uint8 TxFifo[UART_SIM_FIFO_SIZE];
+    uint8 TxCount;
+    uint16 RxFifo[UART_SIM_FIFO_SIZE];      /* Byte and error flags (bits 11:8) like DR */
+    uint8 RxCount;
+    uint32 Raised;                          /* Raw interrupt status */
+}UartSim_HwType;
+
+static UartSim_HwType g_Hw[UART_SIM_UNITS];
+
+/* Data register and interrupt clear register accesses not settled yet */
+static UartSim_HwType * g_Pending_Dr = NULL;
+static UartSim_HwType * g_Pending_Icr = NULL;
+
+/* Bytes sent on the line of UART0 */
+static uint8 g_Wire[256];
+static uint32 g_Wire_Count = 0;
+
+/* Stubs of the modules used by Uart.c */
+static uint32 g_Sys_Clock = 80000000UL;
+static Irq_HandlerType g_Handlers[256];
+static uint32 g_Det_Count = 0;
+static uint8 g_Det_Last_Api = 0;
+static uint8 g_Det_Last_Error = 0;
+static uint32 g_Notifications = 0;
+
+static unsigned int g_Checks = 0;
+static unsigned int g_Failures = 0;
+
+#define CHECK(COND)   UartTest_Check((COND), #COND, __LINE__)
+
+/*********************************************************************************************/
+static void UartTest_Check(int Condition, const char * Text, int Line)
+{
+    g_Checks++;
+    if(!Condition)
+    {
+        g_Failures++;
+        printf("FAIL line %d: %s\n", Line, Text);
+    }
+}
+
+/*********************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void)
+{
+    return g_Sys_Clock;
+}
+
+void SuspendAllInterrupts(void)
+{
+}
+
+void ResumeAllInterrupts(void)
+{
+}
+
+void Irq_Register(Irq_NumberType IrqNum, Irq_HandlerType Handler, Irq_PriorityType Priority)
+{
+    (void)Priority;
+    g_Handlers[IrqNum] = Handler;
+}
+
+void Irq_EnableInterrupt(Irq_NumberType IrqNum)
+{
+    (void)IrqNum;
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    g_Det_Count++;
+    g_Det_Last_Api   = ApiId;
+    g_Det_Last_Error = ErrorId;
+    return E_OK;
+}
+
+static void UartTest_RxNotification(void);
+
+/* Console channel of Uart_PBcfg.c with a notification counting the receptions */
+const Uart_ConfigType Uart_Configuration = {
+                                               {{UART_HW_0,115200UL,8,UART_PARITY_NONE,1,UART_FIFO_1_2,UART_FIFO_1_8,UartTest_RxNotification}}
+                                           };
+
+/*********************************************************************************************/
+/* Description: Apply the effect of the last data register and interrupt clear register accesses */
+static void UartSim_Settle(void)
+{
+    UartSim_HwType * hw = g_Pending_Dr;
+    uint32 value;
+
+    if(hw != NULL)
+    {
+        value = hw->Regs[UART_DR_REG_OFFSET / 4U];
+        if(0U != (value & UART_SIM_READ_MARK))
+        {
+            if(hw->RxCount != 0U)
+            {
+                hw->RxCount--;
+                memmove(&hw->RxFifo[0], &hw->RxFifo[1], hw->RxCount * sizeof(hw->RxFifo[0]));
+            }
+        }
+        else if(hw->TxCount < UART_SIM_FIFO_SIZE)
+        {
+            hw->TxFifo[hw->TxCount++] = (uint8)value;
+        }
+        else
+        {
+            printf("FAIL: write to a full TX FIFO\n");
+            g_Failures++;
+        }
+        g_Pending_Dr = NULL;
+    }
+
+    hw = g_Pending_Icr;
+    if(hw != NULL)
+    {
+        hw->Raised &= ~hw->Regs[UART_ICR_REG_OFFSET / 4U];
+        g_Pending_Icr = NULL;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Word of a simulated register, the status registers are computed for the access */
+static volatile uint32 * UartSim_Reg(uint32 Base, uint32 Offset)
+{
+    UartSim_HwType * hw = &g_Hw[(Base - UART_HW0_BASE_ADDRESS) >> 12];
+    uint32 * reg = &hw->Regs[Offset / 4U];
+
+    UartSim_Settle();
+
+    switch(Offset)
+    {
+        case UART_DR_REG_OFFSET:
+            *reg = UART_SIM_READ_MARK | ((hw->RxCount != 0U) ? hw->RxFifo[0] : 0U);
+            g_Pending_Dr = hw;
+            break;
+        case UART_FR_REG_OFFSET:
+            *reg = ((hw->RxCount == 0U) ? UART_FR_RXFE : 0U) | ((hw->TxCount == UART_SIM_FIFO_SIZE) ? UART_FR_TXFF : 0U);
+            break;
+        case UART_MIS_REG_OFFSET:
+            *reg = hw->Raised & hw->Regs[UART_IM_REG_OFFSET / 4U];
+            break;
+        case UART_ICR_REG_OFFSET:
+            *reg = 0;
+            g_Pending_Icr = hw;
+            break;
+        default:
+            break;
+    }
+    return reg;
+}
+
+/*********************************************************************************************/
+/* Description: Number of bytes of a FIFO level of the IFLS register */
+static uint8 UartSim_Level(uint32 Field)
+{
+    static const uint8 levels[5] = { 2U, 4U, 8U, 12U, 14U };
+
+    return levels[Field & 0x7U];
+}
+
+/*********************************************************************************************/
+/* Description: Run the ISR of UART0 while one of its unmasked interrupts is raised */
+static void UartSim_RunIsr(void)
+{
+    UartSim_HwType * hw = &g_Hw[0];
+
+    UartSim_Settle();
+    while(0U != (hw->Raised & hw->Regs[UART_IM_REG_OFFSET / 4U]))
+    {
+        g_Handlers[UART_SIM_UART0_IRQ]();
+        UartSim_Settle();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Send one byte of the TX FIFO of UART0 on the line, the transmit interrupt is
+ *              raised when the FIFO drains down to its level */
+static void UartSim_SendByte(void)
+{
+    UartSim_HwType * hw = &g_Hw[0];
+    uint8 level = UartSim_Level(hw->Regs[UART_IFLS_REG_OFFSET / 4U] >> UART_IFLS_TX_POS);
+
+    UartSim_Settle();
+    if(hw->TxCount != 0U)
+    {
+        g_Wire[g_Wire_Count++ % sizeof(g_Wire)] = hw->TxFifo[0];
+        hw->TxCount--;
+        memmove(&hw->TxFifo[0], &hw->TxFifo[1], hw->TxCount);
+        if(hw->TxCount == level)
+        {
+            hw->Raised |= UART_INT_TX;
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Send the line of UART0 until its TX FIFO and the transmit ring are empty */
+static void UartSim_SendAll(void)
+{
+    UartSim_Settle();
+    while(g_Hw[0].TxCount != 0U)
+    {
+        UartSim_SendByte();
+        UartSim_RunIsr();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Receive one byte on UART0 with its error flags, the receive interrupt is raised
+ *              when the RX FIFO fills up to its level */
+static void UartSim_ReceiveByte(uint8 Data, uint16 Errors)
+{
+    UartSim_HwType * hw = &g_Hw[0];
+    uint8 level = UartSim_Level(hw->Regs[UART_IFLS_REG_OFFSET / 4U] >> UART_IFLS_RX_POS);
+
+    UartSim_Settle();
+    if(hw->RxCount < UART_SIM_FIFO_SIZE)
+    {
+        hw->RxFifo[hw->RxCount++] = (uint16)(Data | Errors);
+        if(hw->RxCount >= level)
+        {
+            hw->Raised |= UART_INT_RX;
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: No new byte for 32 bit periods, the receive timeout is raised if bytes remain */
+static void UartSim_RxTimeout(void)
+{
+    UartSim_Settle();
+    if(g_Hw[0].RxCount != 0U)
+    {
+        g_Hw[0].Raised |= UART_INT_RT;
+    }
+}
+
+/*********************************************************************************************/
+static void UartTest_RxNotification(void)
+{
+    g_Notifications++;
+}
+
+/*********************************************************************************************/
+static void UartTest_Init(void)
+{
+    uint32 * regs = g_Hw[0].Regs;
+    uint8 data = 0;
+
+    /* The APIs report UART_E_UNINIT before Uart_Init */
+    CHECK(Uart_Write(UartConf_CONSOLE_CHANNEL_ID_INDEX, &data, 1) == 0);
+    CHECK((g_Det_Last_Api == UART_WRITE_SID) && (g_Det_Last_Error == UART_E_UNINIT));
+
+    Uart_Init(&Uart_Configuration);
+    UartSim_Settle();
+
+    /* 80 MHz / (16 * 115200) = 43.40 --> IBRD 43, FBRD 26 */
+    CHECK((g_Sim_Rcgc & 0x01U) != 0U);
+    CHECK(regs[UART_IBRD_REG_OFFSET / 4U] == 43U);
+    CHECK(regs[UART_FBRD_REG_OFFSET / 4U] == 26U);
+    CHECK(regs[UART_LCRH_REG_OFFSET / 4U] == (UART_LCRH_FEN | (3UL << UART_LCRH_WLEN_POS)));
+    CHECK(regs[UART_IFLS_REG_OFFSET / 4U] == (((uint32)UART_FIFO_1_2 << UART_IFLS_RX_POS) | ((uint32)UART_FIFO_1_8 << UART_IFLS_TX_POS)));
+    CHECK(regs[UART_IM_REG_OFFSET / 4U] == (UART_INT_RX | UART_INT_RT));
+    CHECK(regs[UART_CTL_REG_OFFSET / 4U] == (UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE));
+    CHECK(g_Handlers[UART_SIM_UART0_IRQ] == Uart_Hw0Isr);
+
+    /* A second Uart_Init is refused */
+    Uart_Init(&Uart_Configuration);
+    CHECK((g_Det_Last_Api == UART_INIT_SID) && (g_Det_Last_Error == UART_E_ALREADY_INITIALIZED));
+}
+
+/*********************************************************************************************/
+static void UartTest_Transmit(void)
+{
+    uint8 data[200];
+    uint32 index;
+    uint32 isr_count = 0;
+    uint8 before;
+
+    for(index = 0; index < sizeof(data); index++)
+    {
+        data[index] = (uint8)(index * 7U + 1U);
+    }
+
+    /* 100 bytes: Uart_Write fills the TX FIFO and unmasks the transmit interrupt */
+    g_Wire_Count = 0;
+    CHECK(Uart_Write(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, 100) == 100);
+    UartSim_Settle();
+    CHECK(g_Hw[0].TxCount == UART_SIM_FIFO_SIZE);
+    CHECK((g_Hw[0].Regs[UART_IM_REG_OFFSET / 4U] & UART_INT_TX) != 0U);
+
+    /* Each transmit interrupt at 2 bytes refills the FIFO with 14 bytes */
+    while(g_Hw[0].TxCount != 0U)
+    {
+        UartSim_SendByte();
+        if(0U != (g_Hw[0].Raised & g_Hw[0].Regs[UART_IM_REG_OFFSET / 4U]))
+        {
+            before = g_Hw[0].TxCount;
+            UartSim_RunIsr();
+            isr_count++;
+            if(Uart_Buffers[0].TxTail != 100U)
+            {
+                CHECK((g_Hw[0].TxCount - before) == 14U);
+            }
+        }
+    }
+    CHECK(g_Wire_Count == 100U);
+    CHECK(memcmp(g_Wire, data, 100) == 0);
+    /* 16 + 6 * 14 bytes, the last refill empties the ring and masks the transmit interrupt */
+    CHECK(isr_count == 6U);
+    CHECK((g_Hw[0].Regs[UART_IM_REG_OFFSET / 4U] & UART_INT_TX) == 0U);
+    CHECK(Uart_GetTxSpace(UartConf_CONSOLE_CHANNEL_ID_INDEX) == UART_TX_BUFFER_SIZE);
+
+    /* 200 bytes: only the ring size is queued, the FIFO takes 16 of them at once */
+    g_Wire_Count = 0;
+    CHECK(Uart_Write(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, 200) == UART_TX_BUFFER_SIZE);
+    CHECK(Uart_GetTxSpace(UartConf_CONSOLE_CHANNEL_ID_INDEX) == UART_SIM_FIFO_SIZE);
+    UartSim_SendAll();
+    CHECK(g_Wire_Count == UART_TX_BUFFER_SIZE);
+    CHECK(memcmp(g_Wire, data, UART_TX_BUFFER_SIZE) == 0);
+
+    /* Parameter errors */
+    CHECK(Uart_Write(UartConf_CONSOLE_CHANNEL_ID_INDEX, NULL_PTR, 1) == 0);
+    CHECK((g_Det_Last_Api == UART_WRITE_SID) && (g_Det_Last_Error == UART_E_PARAM_POINTER));
+    CHECK(Uart_Write(UART_NUMBER_OF_CHANNELS, data, 1) == 0);
+    CHECK((g_Det_Last_Api == UART_WRITE_SID) && (g_Det_Last_Error == UART_E_PARAM_CHANNEL));
+}
+
+/*********************************************************************************************/
+static void UartTest_Receive(void)
+{
+    uint8 data[UART_RX_BUFFER_SIZE + 16U];
+    uint32 index;
+    uint32 det_count;
+
+    /* 7 bytes stay below the level of 8, the receive timeout drains them */
+    g_Notifications = 0;
+    for(index = 0; index < 7U; index++)
+    {
+        UartSim_ReceiveByte((uint8)(0x30U + index), 0);
+    }
+    UartSim_RunIsr();
+    CHECK(Uart_GetRxCount(UartConf_CONSOLE_CHANNEL_ID_INDEX) == 0U);
+    UartSim_RxTimeout();
+    UartSim_RunIsr();
+    CHECK(g_Hw[0].RxCount == 0U);
+    CHECK(g_Notifications == 1U);
+    CHECK(Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, sizeof(data)) == 7U);
+    CHECK((data[0] == 0x30U) && (data[6] == 0x36U));
+
+    /* 8 bytes reach the level */
+    for(index = 0; index < 8U; index++)
+    {
+        UartSim_ReceiveByte((uint8)index, 0);
+    }
+    UartSim_RunIsr();
+    CHECK(Uart_GetRxCount(UartConf_CONSOLE_CHANNEL_ID_INDEX) == 8U);
+    CHECK(Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, 3) == 3U);
+    CHECK(Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, sizeof(data)) == 5U);
+    CHECK((data[0] == 3U) && (data[4] == 7U));
+
+    /* 72 bytes without reading: the ring keeps 64 and reports the overflow */
+    det_count = g_Det_Count;
+    for(index = 0; index < (UART_RX_BUFFER_SIZE + 8U); index++)
+    {
+        UartSim_ReceiveByte((uint8)index, 0);
+        UartSim_RunIsr();
+    }
+    CHECK(g_Det_Count > det_count);
+    CHECK((g_Det_Last_Api == UART_ISR_SID) && (g_Det_Last_Error == UART_E_RX_OVERFLOW));
+    CHECK(Uart_GetRxCount(UartConf_CONSOLE_CHANNEL_ID_INDEX) == UART_RX_BUFFER_SIZE);
+    CHECK(Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, sizeof(data)) == UART_RX_BUFFER_SIZE);
+    CHECK((data[0] == 0U) && (data[UART_RX_BUFFER_SIZE - 1U] == (UART_RX_BUFFER_SIZE - 1U)));
+
+    /* A byte with a framing error is dropped */
+    UartSim_ReceiveByte(0x55U, 0x100U);
+    UartSim_ReceiveByte(0x66U, 0);
+    UartSim_RxTimeout();
+    UartSim_RunIsr();
+    CHECK((g_Det_Last_Api == UART_ISR_SID) && (g_Det_Last_Error == UART_E_RX_LINE_ERROR));
+    CHECK(Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, sizeof(data)) == 1U);
+    CHECK(data[0] == 0x66U);
+}
+
+/*********************************************************************************************/
+static void UartTest_Wrap(void)
+{
+    uint8 data[37];
+    uint8 received[37];
+    uint32 round;
+    uint32 index;
+    unsigned int errors = 0;
+
+    /* 2000 messages of 37 bytes each way, the 16 bits indexes wrap after 65536 bytes */
+    for(round = 0; round < 2000U; round++)
+    {
+        for(index = 0; index < sizeof(data); index++)
+        {
+            data[index] = (uint8)(round + index);
+        }
+
+        g_Wire_Count = 0;
+        if(Uart_Write(UartConf_CONSOLE_CHANNEL_ID_INDEX, data, sizeof(data)) != sizeof(data))
+        {
+            errors++;
+        }
+        UartSim_SendAll();
+        if((g_Wire_Count != sizeof(data)) || (memcmp(g_Wire, data, sizeof(data)) != 0))
+        {
+            errors++;
+        }
+
+        for(index = 0; index < sizeof(data); index++)
+        {
+            UartSim_ReceiveByte(data[index], 0);
+            UartSim_RunIsr();
+        }
+        UartSim_RxTimeout();
+        UartSim_RunIsr();
+        if((Uart_Read(UartConf_CONSOLE_CHANNEL_ID_INDEX, received, sizeof(received)) != sizeof(received))
+           || (memcmp(received, data, sizeof(data)) != 0))
+        {
+            errors++;
+        }
+    }
+    CHECK(errors == 0U);
+    CHECK(Uart_Buffers[0].TxHead == (uint16)(100U + UART_TX_BUFFER_SIZE + 2000U * sizeof(data)));
+}
+
+/*********************************************************************************************/
+static void UartTest_ClockChange(void)
+{
+    uint32 * regs = g_Hw[0].Regs;
+
+    /* 16 MHz / (16 * 115200) = 8.68 --> IBRD 8, FBRD 44 */
+    g_Sys_Clock = 16000000UL;
+    Uart_ClockNotification();
+    UartSim_Settle();
+    CHECK(regs[UART_IBRD_REG_OFFSET / 4U] == 8U);
+    CHECK(regs[UART_FBRD_REG_OFFSET / 4U] == 44U);
+    CHECK((regs[UART_CTL_REG_OFFSET / 4U] & UART_CTL_UARTEN) != 0U);
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    UartTest_Init();
+    UartTest_Transmit();
+    UartTest_Receive();
+    UartTest_Wrap();
+    UartTest_ClockChange();
+
+    printf("Uart_HostTest: %u checks, %u failed\n", g_Checks, g_Failures);
+    return (g_Failures == 0U) ? 0 : 1;
+}